@@ -1,10 +1,35 @@
 #ifndef MODULE_HANDLE_H
 #define MODULE_HANDLE_H
 
+// CORVUS_CMODEL_SAVABLE: every model was verilated with --savable, so handles
+// can checkpoint their model through VerilatedSave/VerilatedRestore. Define it
+// consistently for all translation units (it changes the vtable).
+#ifdef CORVUS_CMODEL_SAVABLE
+#include "verilated_save.h"
+#endif
+
+class VerilatedContext;
+
+// Construct a Verilator model. With CORVUS_CMODEL_CONTEXT (Verilator >= 4.210)
+// a non-null `context` keeps the model out of the process-global context, so
+// several CModel instances do not share time, $finish or random state.
+template <typename VModuleType>
+VModuleType* corvusNewModule(VerilatedContext* context) {
+#ifdef CORVUS_CMODEL_CONTEXT
+    if (context) return new VModuleType(context);
+#endif
+    (void)context;
+    return new VModuleType();
+}
+
 class ModuleHandle {
 public:
     virtual ~ModuleHandle() = default;
     virtual void eval() = 0;
+#ifdef CORVUS_CMODEL_SAVABLE
+    virtual void save(VerilatedSerialize& os) = 0;
+    virtual void restore(VerilatedDeserialize& is) = 0;
+#endif
 };
 
 template <typename VModuleType>
@@ -15,5 +40,13 @@ public:
     void eval() override {
         mp->eval();
     }
+#ifdef CORVUS_CMODEL_SAVABLE
+    void save(VerilatedSerialize& os) override {
+        os << *mp;
+    }
+    void restore(VerilatedDeserialize& is) override {
+        is >> *mp;
+    }
+#endif
 };
 #endif // MODULE_HANDLE_H
\ No newline at end of file
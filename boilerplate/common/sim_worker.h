@@ -14,9 +14,25 @@ public:
     void cleanup() {
         deleteSimModules();
     }
+#ifdef CORVUS_CMODEL_SAVABLE
+    // Only valid while the worker loop is not running.
+    void saveModules(VerilatedSerialize& os) {
+        cModule->save(os);
+        sModule->save(os);
+    }
+    void restoreModules(VerilatedDeserialize& is) {
+        cModule->restore(is);
+        sModule->restore(is);
+    }
+#endif
 
+    // Context handed to corvusNewModule() by createSimModules(); set before init().
+    void setVerilatedContext(VerilatedContext* context) {
+        verilatedContext = context;
+    }
 
 protected:
+    VerilatedContext* verilatedContext = nullptr;
     ModuleHandle* cModule = nullptr;
     ModuleHandle* sModule = nullptr;
     virtual void createSimModules() = 0;
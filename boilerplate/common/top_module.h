@@ -1,6 +1,8 @@
 #ifndef TOP_MODULE_H
 #define TOP_MODULE_H
 
+#include <cstdint>
+
 #include "top_ports.h"
 #include "module_handle.h"
 
@@ -21,15 +23,35 @@ public:
     TopPorts* topPorts = nullptr;
     virtual void prepareSimWorker() = 0;
     virtual void evalE() {
-        eModule->eval();
+        if (eModule) eModule->eval();
     }
     virtual void eval() = 0;
+    // Context handed to corvusNewModule() by createExternalModule(); set before init().
+    void setVerilatedContext(VerilatedContext* context) {
+        verilatedContext = context;
+    }
+#ifdef CORVUS_CMODEL_SAVABLE
+    // A presence byte keeps checkpoints of designs without an external model valid.
+    void saveExternal(VerilatedSerialize& os) {
+        uint8_t present = eModule ? 1 : 0;
+        os << present;
+        if (eModule) eModule->save(os);
+    }
+    bool restoreExternal(VerilatedDeserialize& is) {
+        uint8_t present = 0;
+        is >> present;
+        if ((present != 0) != (eModule != nullptr)) return false;
+        if (eModule) eModule->restore(is);
+        return true;
+    }
+#endif
 protected:
     virtual TopPorts* createTopPorts() = 0;
     virtual void deleteTopPorts() = 0;
     virtual ModuleHandle* createExternalModule() = 0;
     virtual void deleteExternalModule() = 0;
 protected:
+    VerilatedContext* verilatedContext = nullptr;
     ModuleHandle* eModule = nullptr;
 };
 
@@ -1,6 +1,82 @@
 #ifndef TOP_PORTS_H
 #define TOP_PORTS_H
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
 class TopPorts {};
 
-#endif // TOP_PORTS_H
\ No newline at end of file
+// Static description of one generated TopPortsGen member. Inputs and outputs
+// each have a packed vector of 32-bit words (see TopPortsGen::setInputs /
+// getOutputs); wordOffset/words locate the port inside its vector.
+struct TopPortDesc {
+    enum Direction : uint8_t { INPUT, OUTPUT };
+    enum WidthType : uint8_t { VL_8, VL_16, VL_32, VL_64, VL_W };
+    const char* name;
+    uint32_t offset;  // byte offset inside TopPortsGen
+    uint32_t width;   // bits
+    WidthType widthType;
+    Direction direction;
+    uint32_t wordOffset;
+    uint32_t words;
+};
+
+// Seeded FNV-1a with a final avalanche. corvusitor builds the generated
+// perfect-hash tables with the same function; keep the two in sync.
+inline uint32_t topPortNameHash(std::string_view name, uint32_t seed) {
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (char c : name) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    return h;
+}
+
+// Hash-and-displace lookup: the name picks a bucket, the bucket's
+// displacement picks a collision-free slot holding the descriptor index.
+inline const TopPortDesc* topPortFind(std::string_view name,
+                                      const TopPortDesc* descs,
+                                      const uint32_t* displacements, uint32_t bucketCount,
+                                      const int32_t* slots, uint32_t slotMask) {
+    if (bucketCount == 0) return nullptr;
+    uint32_t d = displacements[topPortNameHash(name, 0) % bucketCount];
+    int32_t idx = slots[topPortNameHash(name, d) & slotMask];
+    if (idx < 0 || name != descs[idx].name) return nullptr;
+    return &descs[idx];
+}
+
+// Generic per-port access through a descriptor (little-endian word order).
+inline void topPortWrite(TopPorts* ports, const TopPortDesc& d, const uint32_t* words) {
+    char* p = reinterpret_cast<char*>(ports) + d.offset;
+    switch (d.widthType) {
+    case TopPortDesc::VL_8: { uint8_t v = static_cast<uint8_t>(words[0]); std::memcpy(p, &v, 1); break; }
+    case TopPortDesc::VL_16: { uint16_t v = static_cast<uint16_t>(words[0]); std::memcpy(p, &v, 2); break; }
+    case TopPortDesc::VL_32: std::memcpy(p, words, 4); break;
+    case TopPortDesc::VL_64: { uint64_t v = words[0] | (static_cast<uint64_t>(words[1]) << 32); std::memcpy(p, &v, 8); break; }
+    case TopPortDesc::VL_W: std::memcpy(p, words, d.words * 4u); break;
+    }
+}
+
+inline void topPortRead(const TopPorts* ports, const TopPortDesc& d, uint32_t* words) {
+    const char* p = reinterpret_cast<const char*>(ports) + d.offset;
+    switch (d.widthType) {
+    case TopPortDesc::VL_8: { uint8_t v; std::memcpy(&v, p, 1); words[0] = v; break; }
+    case TopPortDesc::VL_16: { uint16_t v; std::memcpy(&v, p, 2); words[0] = v; break; }
+    case TopPortDesc::VL_32: std::memcpy(words, p, 4); break;
+    case TopPortDesc::VL_64: {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        words[0] = static_cast<uint32_t>(v);
+        words[1] = static_cast<uint32_t>(v >> 32);
+        break;
+    }
+    case TopPortDesc::VL_W: std::memcpy(words, p, d.words * 4u); break;
+    }
+}
+
+#endif // TOP_PORTS_H
@@ -3,14 +3,35 @@
 
 #include <cstdint>
 
+// Bit 63 of an SBus payload under CorvusSyncMode::SBUS_PARITY/DATAFLOW: the
+// sender's cycle parity. Slot ids and slice data never reach it.
+constexpr uint64_t kCorvusBusParityBit = 1ULL << 63;
+
 // Virtual base class for bus endpoints
 class CorvusBusEndpoint {
 public:
   virtual ~CorvusBusEndpoint() = default;
   virtual void send(uint32_t targetId, uint64_t payload) = 0;
+  // Multicast frame: one payload for every endpoint whose bit is set in
+  // targetMask (so only endpoint ids < 64). Buses without multicast support
+  // fall back to one send() per target.
+  virtual void sendMulticast(uint64_t targetMask, uint64_t payload) {
+    for (uint32_t id = 0; targetMask != 0; ++id, targetMask >>= 1) {
+      if (targetMask & 1ULL) send(id, payload);
+    }
+  }
   virtual uint64_t recv() = 0;
   virtual int bufferCnt() const = 0;
   virtual void clearBuffer() = 0;
+  // Parity-split receive buffer (CorvusSyncMode::SBUS_PARITY/DATAFLOW). After
+  // setCycleParity(p), sends are tagged with parity p and recv()/bufferCnt()
+  // only see frames tagged 1 - p, i.e. those sent in the previous cycle;
+  // frames of the current cycle wait in the other half. Returns false when
+  // the endpoint cannot split its buffer.
+  virtual bool setCycleParity(uint32_t parity) {
+    (void)parity;
+    return false;
+  }
 };
 
 #endif // CORVUS_BUS_ENDPOINT_H
\ No newline at end of file
@@ -0,0 +1,575 @@
+#include "corvus_plan_sim_worker.h"
+#include "../../include/corvus_bus_plan_view.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+// Minimal JSON reader for <output>_corvus_bus_plan.json (objects, arrays,
+// strings, integers). Only used when no binary plan is available.
+struct JsonValue {
+    enum Type { NUL, NUMBER, STRING, ARRAY, OBJECT };
+    Type type = NUL;
+    long long number = 0;
+    std::string str;
+    std::vector<JsonValue> items;
+    std::vector<std::pair<std::string, JsonValue>> fields;
+
+    const JsonValue* get(const std::string& key) const {
+        for (const auto& kv : fields) {
+            if (kv.first == key) return &kv.second;
+        }
+        return nullptr;
+    }
+};
+
+class JsonParser {
+public:
+    JsonParser(const char* p, const char* end) : p(p), end(end) {}
+
+    JsonValue parse() {
+        JsonValue v = value();
+        skipSpace();
+        if (p != end) fail("trailing characters");
+        return v;
+    }
+
+private:
+    const char* p;
+    const char* end;
+
+    [[noreturn]] void fail(const char* why) {
+        throw std::runtime_error(std::string("invalid JSON plan: ") + why);
+    }
+    void skipSpace() {
+        while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) ++p;
+    }
+    void expect(char c) {
+        skipSpace();
+        if (p >= end || *p != c) fail("unexpected character");
+        ++p;
+    }
+    JsonValue value() {
+        skipSpace();
+        if (p >= end) fail("unexpected end");
+        JsonValue v;
+        if (*p == '{') {
+            ++p;
+            v.type = JsonValue::OBJECT;
+            skipSpace();
+            if (p < end && *p == '}') { ++p; return v; }
+            while (true) {
+                skipSpace();
+                std::string key = string();
+                expect(':');
+                v.fields.emplace_back(std::move(key), value());
+                skipSpace();
+                if (p < end && *p == ',') { ++p; continue; }
+                expect('}');
+                return v;
+            }
+        }
+        if (*p == '[') {
+            ++p;
+            v.type = JsonValue::ARRAY;
+            skipSpace();
+            if (p < end && *p == ']') { ++p; return v; }
+            while (true) {
+                v.items.push_back(value());
+                skipSpace();
+                if (p < end && *p == ',') { ++p; continue; }
+                expect(']');
+                return v;
+            }
+        }
+        if (*p == '"') {
+            v.type = JsonValue::STRING;
+            v.str = string();
+            return v;
+        }
+        if (*p == '-' || (*p >= '0' && *p <= '9')) {
+            char* stop = nullptr;
+            v.type = JsonValue::NUMBER;
+            v.number = std::strtoll(p, &stop, 10);
+            p = stop;
+            return v;
+        }
+        if (end - p >= 4 && std::strncmp(p, "null", 4) == 0) {
+            p += 4;
+            return v;
+        }
+        fail("unsupported value");
+    }
+    std::string string() {
+        if (p >= end || *p != '"') fail("expected string");
+        ++p;
+        std::string s;
+        while (p < end && *p != '"') {
+            if (*p == '\\' && p + 1 < end) {
+                ++p;
+                switch (*p) {
+                case 'n': s.push_back('\n'); break;
+                case 't': s.push_back('\t'); break;
+                case 'r': s.push_back('\r'); break;
+                default: s.push_back(*p); break;
+                }
+                ++p;
+            } else {
+                s.push_back(*p++);
+            }
+        }
+        if (p >= end) fail("unterminated string");
+        ++p;
+        return s;
+    }
+};
+
+long long jsonInt(const JsonValue& obj, const char* key) {
+    const JsonValue* v = obj.get(key);
+    return v && v->type == JsonValue::NUMBER ? v->number : 0;
+}
+
+std::string jsonStr(const JsonValue& obj, const char* key) {
+    const JsonValue* v = obj.get(key);
+    return v && v->type == JsonValue::STRING ? v->str : std::string();
+}
+
+const JsonValue& jsonArray(const JsonValue& obj, const char* key) {
+    static const JsonValue empty;
+    const JsonValue* v = obj.get(key);
+    return v && v->type == JsonValue::ARRAY ? *v : empty;
+}
+
+bool endsWith(const std::string& s, const char* suffix) {
+    size_t n = std::strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+uint64_t readPort(const CorvusPlanPort& port) {
+    switch (port.kind) {
+    case CorvusPlanPort::U8: return *static_cast<const uint8_t*>(port.addr);
+    case CorvusPlanPort::U16: return *static_cast<const uint16_t*>(port.addr);
+    case CorvusPlanPort::U32: return *static_cast<const uint32_t*>(port.addr);
+    case CorvusPlanPort::U64: return *static_cast<const uint64_t*>(port.addr);
+    default: return 0;
+    }
+}
+
+void writePort(const CorvusPlanPort& port, uint64_t value) {
+    switch (port.kind) {
+    case CorvusPlanPort::U8: *static_cast<uint8_t*>(port.addr) = static_cast<uint8_t>(value); break;
+    case CorvusPlanPort::U16: *static_cast<uint16_t*>(port.addr) = static_cast<uint16_t>(value); break;
+    case CorvusPlanPort::U32: *static_cast<uint32_t*>(port.addr) = static_cast<uint32_t>(value); break;
+    case CorvusPlanPort::U64: *static_cast<uint64_t*>(port.addr) = value; break;
+    default: break;
+    }
+}
+
+// Same 16-bit slice encoding as the generated send blocks.
+inline uint64_t encodeSlice(const CorvusPlanPort& port, int32_t bitOffset, uint32_t slotId) {
+    uint64_t sliceData;
+    if (port.kind == CorvusPlanPort::WIDE) {
+        const uint32_t* words = static_cast<const uint32_t*>(port.addr);
+        sliceData = (static_cast<uint64_t>(words[bitOffset / 32]) >> (bitOffset % 32)) & 0xFFFFULL;
+    } else {
+        sliceData = (readPort(port) >> bitOffset) & 0xFFFFULL;
+    }
+    return static_cast<uint64_t>(slotId) | (sliceData << 32);
+}
+
+// Same decoding as the generated switch cases.
+inline void decodeSlice(const CorvusPlanPort& port, int32_t bitOffset, uint64_t data) {
+    if (port.kind == CorvusPlanPort::WIDE) {
+        uint32_t* words = static_cast<uint32_t*>(port.addr);
+        int word = bitOffset / 32;
+        int wordBit = bitOffset % 32;
+        uint32_t lowMask = static_cast<uint32_t>(0xFFFFULL << wordBit);
+        uint32_t lowBits = static_cast<uint32_t>(data << wordBit);
+        words[word] = (words[word] & ~lowMask) | lowBits;
+    } else if (port.kind == CorvusPlanPort::U8 || port.kind == CorvusPlanPort::U16) {
+        writePort(port, data);
+    } else {
+        uint64_t cur = readPort(port);
+        uint64_t mask = 0xFFFFULL << bitOffset;
+        cur = (cur & ~mask) | ((data & 0xFFFFULL) << bitOffset);
+        writePort(port, cur);
+    }
+}
+
+} // namespace
+
+void CorvusPlanPortMap::insert(const char* name, void* addr, CorvusPlanPort::Kind kind, uint32_t words) {
+    CorvusPlanPort port;
+    port.addr = addr;
+    port.kind = kind;
+    port.words = words;
+    ports[name] = port;
+}
+
+const CorvusPlanPort* CorvusPlanPortMap::find(const std::string& name) const {
+    auto it = ports.find(name);
+    return it == ports.end() ? nullptr : &it->second;
+}
+
+CorvusPlanSimWorker::CorvusPlanSimWorker(CorvusSimWorkerSynctreeEndpoint* simWorkerSynctreeEndpoint,
+                                         std::vector<CorvusBusEndpoint*> mBusEndpoints,
+                                         std::vector<CorvusBusEndpoint*> sBusEndpoints,
+                                         int partitionId,
+                                         std::string planPath)
+    : CorvusSimWorker(simWorkerSynctreeEndpoint, std::move(mBusEndpoints), std::move(sBusEndpoints)),
+      partitionId(partitionId),
+      planPath(std::move(planPath)) {
+    setName("CorvusPlanSimWorkerP" + std::to_string(partitionId));
+}
+
+void CorvusPlanSimWorker::createSimModules() {
+    combPorts.clear();
+    seqPorts.clear();
+    createPlanModules(combPorts, seqPorts);
+    RawPlan plan;
+    std::string error;
+    if (!loadPlan(plan, error)) {
+        throw std::runtime_error("[CorvusPlanSimWorker] " + error);
+    }
+    compilePlan(plan);
+}
+
+void CorvusPlanSimWorker::deleteSimModules() {
+    deletePlanModules();
+    combPorts.clear();
+    seqPorts.clear();
+}
+
+bool CorvusPlanSimWorker::loadPlan(RawPlan& plan, std::string& error) const {
+    if (endsWith(planPath, ".json")) {
+        return loadJsonPlan(plan, error);
+    }
+    return loadBinaryPlan(plan, error);
+}
+
+bool CorvusPlanSimWorker::loadBinaryPlan(RawPlan& plan, std::string& error) const {
+    CorvusBusPlanView view;
+    if (!view.open(planPath, error)) {
+        return false;
+    }
+    const auto* w = view.find_worker(partitionId);
+    if (!w) {
+        error = "partition " + std::to_string(partitionId) + " not found in " + planPath;
+        return false;
+    }
+    auto str = [&](uint32_t id) {
+        std::string_view s = view.string(id);
+        return std::string(s.data(), s.size());
+    };
+    for (const auto& r : view.load_mbus_c_inputs(*w)) {
+        plan.loadMBusCInputs.push_back({str(r.portName), r.slotId, r.bitOffset, r.slotBit, r.packWidth});
+    }
+    for (const auto& r : view.load_sbus_c_inputs(*w)) {
+        plan.loadSBusCInputs.push_back({str(r.portName), r.slotId, r.bitOffset, r.slotBit, r.packWidth});
+    }
+    for (const auto& r : view.send_mbus_c_outputs(*w)) {
+        plan.sendMBusCOutputs.push_back(
+            {str(r.portName), r.bitOffset, r.targetId, r.slotId, r.slotBit, r.packWidth, r.targetMask});
+    }
+    for (const auto& r : view.copy_s_inputs(*w)) {
+        plan.copySInputs.push_back(str(r.portName));
+    }
+    for (const auto& r : view.send_sbus_s_outputs(*w)) {
+        plan.sendSBusSOutputs.push_back(
+            {str(r.portName), r.bitOffset, r.targetId, r.slotId, r.slotBit, r.packWidth, r.targetMask});
+    }
+    for (const auto& r : view.copy_local_c_inputs(*w)) {
+        plan.copyLocalCInputs.push_back(str(r.portName));
+    }
+    plan.sbusCount = view.sbus_count();
+    plan.xbusCount = view.xbus_count();
+    for (const auto& entry : view.workers()) {
+        plan.groups[entry.pid] = static_cast<int32_t>(entry.group);
+    }
+    return true;
+}
+
+bool CorvusPlanSimWorker::loadJsonPlan(RawPlan& plan, std::string& error) const {
+    std::ifstream ifs(planPath, std::ios::binary);
+    if (!ifs.is_open()) {
+        error = "Failed to open: " + planPath;
+        return false;
+    }
+    std::string text((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    JsonValue root;
+    try {
+        root = JsonParser(text.data(), text.data() + text.size()).parse();
+    } catch (const std::exception& e) {
+        error = std::string(e.what()) + ": " + planPath;
+        return false;
+    }
+    const JsonValue* workers = root.get("simWorkerPlans");
+    const JsonValue* w = workers ? workers->get(std::to_string(partitionId)) : nullptr;
+    if (!w) {
+        error = "partition " + std::to_string(partitionId) + " not found in " + planPath;
+        return false;
+    }
+    if (const JsonValue* lanes = root.get("laneSelection")) {
+        plan.sbusCount = static_cast<int32_t>(jsonInt(*lanes, "sbusCount"));
+        plan.xbusCount = static_cast<int32_t>(jsonInt(*lanes, "xbusCount"));
+    }
+    for (const auto& kv : workers->fields) {
+        plan.groups[static_cast<int32_t>(std::atoi(kv.first.c_str()))] =
+            static_cast<int32_t>(jsonInt(kv.second, "group"));
+    }
+    auto recvs = [&](const char* key, std::vector<RawRecv>& out) {
+        for (const auto& r : jsonArray(*w, key).items) {
+            out.push_back({jsonStr(r, "portName"), static_cast<int32_t>(jsonInt(r, "slotId")),
+                           static_cast<int32_t>(jsonInt(r, "bitOffset")),
+                           static_cast<int32_t>(jsonInt(r, "slotBit")),
+                           static_cast<int32_t>(jsonInt(r, "packWidth"))});
+        }
+    };
+    auto sends = [&](const char* key, std::vector<RawSend>& out) {
+        for (const auto& r : jsonArray(*w, key).items) {
+            out.push_back({jsonStr(r, "portName"), static_cast<int32_t>(jsonInt(r, "bitOffset")),
+                           static_cast<int32_t>(jsonInt(r, "targetId")),
+                           static_cast<int32_t>(jsonInt(r, "slotId")),
+                           static_cast<int32_t>(jsonInt(r, "slotBit")),
+                           static_cast<int32_t>(jsonInt(r, "packWidth")),
+                           std::strtoull(jsonStr(r, "targetMask").c_str(), nullptr, 16)});
+        }
+    };
+    auto copies = [&](const char* key, std::vector<std::string>& out) {
+        for (const auto& r : jsonArray(*w, key).items) {
+            out.push_back(jsonStr(r, "portName"));
+        }
+    };
+    recvs("loadMBusCInputs", plan.loadMBusCInputs);
+    recvs("loadSBusCInputs", plan.loadSBusCInputs);
+    sends("sendMBusCOutputs", plan.sendMBusCOutputs);
+    copies("copySInputs", plan.copySInputs);
+    sends("sendSBusSOutputs", plan.sendSBusSOutputs);
+    copies("copyLocalCInputs", plan.copyLocalCInputs);
+    return true;
+}
+
+const CorvusPlanPort& CorvusPlanSimWorker::resolve(const CorvusPlanPortMap& ports,
+                                                   const std::string& name,
+                                                   const char* module) {
+    const CorvusPlanPort* port = ports.find(name);
+    if (!port) {
+        throw std::runtime_error("[CorvusPlanSimWorker] " + this->name() + ": plan references unknown " +
+                                 module + " port '" + name + "'");
+    }
+    return *port;
+}
+
+void CorvusPlanSimWorker::buildRecvTable(const std::vector<RawRecv>& recs, RecvTable& table) {
+    // Counting sort by slot id; records of one slot keep their plan order.
+    size_t slots = 0;
+    for (const auto& r : recs) {
+        if (r.slotId >= 0) slots = std::max(slots, static_cast<size_t>(r.slotId) + 1);
+    }
+    table.slotStart.assign(slots + 1, 0);
+    for (const auto& r : recs) {
+        if (r.slotId >= 0) ++table.slotStart[r.slotId + 1];
+    }
+    for (size_t s = 0; s < slots; ++s) {
+        table.slotStart[s + 1] += table.slotStart[s];
+    }
+    table.ops.assign(table.slotStart[slots], RecvOp());
+    std::vector<uint32_t> next(table.slotStart.begin(), table.slotStart.end() - 1);
+    for (const auto& r : recs) {
+        if (r.slotId < 0) continue;
+        RecvOp& op = table.ops[next[r.slotId]++];
+        op.port = resolve(combPorts, r.port, "comb");
+        op.bitOffset = r.bitOffset;
+        op.slotBit = r.slotBit;
+        op.packMask = r.packWidth > 0 ? (1ULL << r.packWidth) - 1 : 0;
+    }
+}
+
+void CorvusPlanSimWorker::buildSendTable(const std::vector<RawSend>& recs, const CorvusPlanPortMap& ports,
+                                         bool toTop, SendTable& table) {
+    table.ops.clear();
+    table.ops.reserve(recs.size());
+    table.packFields.clear();
+    // Multicast records (targetMask) that carry the same slice under the same
+    // slot id, one per receiver of a --multicast fan-out, are a single frame.
+    std::map<std::tuple<std::string, int32_t, int32_t>, size_t> frames;
+    // Narrow signals packed into one slot of one target, or of one targetMask
+    // (a cross-group bin), form a single frame.
+    std::map<std::tuple<uint32_t, uint64_t, int32_t>, size_t> packedFrames;
+    std::vector<std::vector<PackField>> packed;
+    for (const auto& r : recs) {
+        const uint32_t targetId = toTop ? 0 : static_cast<uint32_t>(r.targetId);
+        const uint64_t targetMask = toTop ? 0 : r.targetMask;
+        if (r.packWidth > 0) {
+            auto key = std::make_tuple(targetMask ? 0 : targetId, targetMask, r.slotId);
+            auto it = packedFrames.emplace(key, table.ops.size()).first;
+            if (it->second == table.ops.size()) {
+                SendOp op;
+                op.targetId = targetId;
+                op.slotId = static_cast<uint32_t>(r.slotId);
+                op.targetMask = targetMask;
+                table.ops.push_back(op);
+                packed.resize(table.ops.size());
+            }
+            PackField field;
+            field.port = resolve(ports, r.port, toTop ? "comb" : "seq");
+            field.slotBit = r.slotBit;
+            field.mask = (1ULL << r.packWidth) - 1;
+            packed[it->second].push_back(field);
+            continue;
+        }
+        if (targetMask) {
+            auto key = std::make_tuple(r.port, r.bitOffset, r.slotId);
+            if (!frames.emplace(std::move(key), table.ops.size()).second) continue;
+        }
+        SendOp op;
+        op.port = resolve(ports, r.port, toTop ? "comb" : "seq");
+        op.bitOffset = r.bitOffset;
+        op.targetId = targetId;
+        op.slotId = static_cast<uint32_t>(r.slotId);
+        op.targetMask = targetMask;
+        table.ops.push_back(op);
+    }
+    packed.resize(table.ops.size());
+    for (size_t i = 0; i < table.ops.size(); ++i) {
+        table.ops[i].packFirst = static_cast<uint32_t>(table.packFields.size());
+        table.ops[i].packCount = static_cast<uint32_t>(packed[i].size());
+        table.packFields.insert(table.packFields.end(), packed[i].begin(), packed[i].end());
+    }
+}
+
+// Same lane choice as the generated sendSBusSOutputs: a frame reaching
+// another group (the lowest one, for multicast) takes that group's
+// inter-group lane, every other frame a round-robin SBus lane.
+void CorvusPlanSimWorker::assignXBusLanes(const RawPlan& plan) {
+    sBusLanes = sBusEndpoints.size();
+    if (plan.xbusCount <= 0) return;
+    sBusLanes = static_cast<size_t>(std::max(1, plan.sbusCount));
+    if (sBusEndpoints.size() < sBusLanes + static_cast<size_t>(plan.xbusCount)) {
+        throw std::runtime_error("[CorvusPlanSimWorker] " + name() + ": plan needs " +
+                                 std::to_string(sBusLanes + plan.xbusCount) + " SBus/XBus endpoints");
+    }
+    auto groupOf = [&](int pid) {
+        auto it = plan.groups.find(pid);
+        return it == plan.groups.end() ? 0 : it->second;
+    };
+    const int own = groupOf(partitionId);
+    for (auto& op : sBusSends.ops) {
+        const int crossed =
+            corvus_bus_plan::crossed_group(own, static_cast<int>(op.targetId), op.targetMask, groupOf);
+        op.xbusLane = crossed < 0 ? -1 : crossed % plan.xbusCount;
+    }
+}
+
+void CorvusPlanSimWorker::buildCopyTable(const std::vector<std::string>& names,
+                                         const CorvusPlanPortMap& srcPorts,
+                                         const CorvusPlanPortMap& dstPorts,
+                                         std::vector<CopyOp>& table) {
+    table.clear();
+    table.reserve(names.size());
+    const char* srcModule = &srcPorts == &combPorts ? "comb" : "seq";
+    const char* dstModule = &dstPorts == &combPorts ? "comb" : "seq";
+    for (const auto& n : names) {
+        table.push_back({resolve(srcPorts, n, srcModule), resolve(dstPorts, n, dstModule)});
+    }
+}
+
+void CorvusPlanSimWorker::compilePlan(const RawPlan& plan) {
+    buildRecvTable(plan.loadMBusCInputs, mBusRecvs);
+    buildRecvTable(plan.loadSBusCInputs, sBusRecvs);
+    buildSendTable(plan.sendMBusCOutputs, combPorts, true, mBusSends);
+    buildSendTable(plan.sendSBusSOutputs, seqPorts, false, sBusSends);
+    assignXBusLanes(plan);
+    buildCopyTable(plan.copySInputs, combPorts, seqPorts, cToSCopies);
+    buildCopyTable(plan.copyLocalCInputs, seqPorts, combPorts, sToCCopies);
+}
+
+void CorvusPlanSimWorker::drainRecv(std::vector<CorvusBusEndpoint*>& endpoints,
+                                    const RecvTable& table) {
+    const uint64_t kSlotMask = 0xFFFFFFFFULL;
+    for (size_t ep = 0; ep < endpoints.size(); ++ep) {
+        int cnt = endpoints[ep]->bufferCnt();
+        for (int i = 0; i < cnt; ++i) {
+            uint64_t payload = endpoints[ep]->recv();
+            uint32_t slotId = static_cast<uint32_t>(payload & kSlotMask);
+            if (static_cast<size_t>(slotId) + 1 >= table.slotStart.size()) continue;
+            const uint64_t data = (payload >> 32) & 0xFFFFULL;
+            for (uint32_t k = table.slotStart[slotId]; k < table.slotStart[slotId + 1]; ++k) {
+                const RecvOp& op = table.ops[k];
+                if (op.packMask) {
+                    writePort(op.port, (data >> op.slotBit) & op.packMask);
+                } else {
+                    decodeSlice(op.port, op.bitOffset, data);
+                }
+            }
+        }
+    }
+}
+
+void CorvusPlanSimWorker::runSends(std::vector<CorvusBusEndpoint*>& endpoints, size_t lanes,
+                                   const SendTable& table) {
+    size_t rr = 0;
+    for (const auto& op : table.ops) {
+        CorvusBusEndpoint* ep = op.xbusLane >= 0 ? endpoints[lanes + op.xbusLane] : endpoints[rr++ % lanes];
+        if (op.packCount) {
+            uint64_t sliceData = 0;
+            for (uint32_t k = op.packFirst; k < op.packFirst + op.packCount; ++k) {
+                const PackField& f = table.packFields[k];
+                sliceData |= (readPort(f.port) & f.mask) << f.slotBit;
+            }
+            const uint64_t payload = static_cast<uint64_t>(op.slotId) | (sliceData << 32);
+            if (op.targetMask) {
+                ep->sendMulticast(op.targetMask, payload);
+            } else {
+                ep->send(op.targetId, payload);
+            }
+        } else if (op.targetMask) {
+            ep->sendMulticast(op.targetMask, encodeSlice(op.port, op.bitOffset, op.slotId));
+        } else {
+            ep->send(op.targetId, encodeSlice(op.port, op.bitOffset, op.slotId));
+        }
+    }
+}
+
+void CorvusPlanSimWorker::runCopies(const std::vector<CopyOp>& table) {
+    for (const auto& op : table) {
+        if (op.dst.kind == CorvusPlanPort::WIDE) {
+            std::memcpy(op.dst.addr, op.src.addr, op.dst.words * sizeof(uint32_t));
+        } else {
+            writePort(op.dst, readPort(op.src));
+        }
+    }
+}
+
+void CorvusPlanSimWorker::loadMBusCInputs() {
+    drainRecv(mBusEndpoints, mBusRecvs);
+}
+
+void CorvusPlanSimWorker::loadSBusCInputs() {
+    drainRecv(sBusEndpoints, sBusRecvs);
+}
+
+void CorvusPlanSimWorker::sendMBusCOutputs() {
+    runSends(mBusEndpoints, mBusEndpoints.size(), mBusSends);
+}
+
+void CorvusPlanSimWorker::copySInputs() {
+    runCopies(cToSCopies);
+}
+
+void CorvusPlanSimWorker::sendSBusSOutputs() {
+    runSends(sBusEndpoints, sBusLanes, sBusSends);
+}
+
+void CorvusPlanSimWorker::copyLocalCInputs() {
+    runCopies(sToCCopies);
+}
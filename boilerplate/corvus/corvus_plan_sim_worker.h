@@ -0,0 +1,157 @@
+#ifndef CORVUS_PLAN_SIM_WORKER_H
+#define CORVUS_PLAN_SIM_WORKER_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "corvus_sim_worker.h"
+
+// Address of one Verilator port as seen by the plan interpreter.
+struct CorvusPlanPort {
+    enum Kind : uint8_t { U8, U16, U32, U64, WIDE };
+    void* addr = nullptr;
+    Kind kind = U8;
+    uint32_t words = 0;  // WIDE only: number of 32-bit words
+};
+
+// Port name -> address table for one module instance. Filled by the generated
+// registry (C<output>PlanWorkerGen.h) right after the module is constructed.
+class CorvusPlanPortMap {
+public:
+    void add(const char* name, uint8_t& v) { insert(name, &v, CorvusPlanPort::U8, 0); }
+    void add(const char* name, uint16_t& v) { insert(name, &v, CorvusPlanPort::U16, 0); }
+    void add(const char* name, uint32_t& v) { insert(name, &v, CorvusPlanPort::U32, 0); }
+    void add(const char* name, uint64_t& v) { insert(name, &v, CorvusPlanPort::U64, 0); }
+    void addWide(const char* name, uint32_t* words, uint32_t count) {
+        insert(name, words, CorvusPlanPort::WIDE, count);
+    }
+    const CorvusPlanPort* find(const std::string& name) const;
+    void clear() { ports.clear(); }
+
+private:
+    void insert(const char* name, void* addr, CorvusPlanPort::Kind kind, uint32_t words);
+    std::unordered_map<std::string, CorvusPlanPort> ports;
+};
+
+// Generic SimWorker that executes its partition's SimWorkerPlan from tables
+// instead of generated switch/case code. The plan is read at createSimModules()
+// time from <output>_corvus_bus_plan.bin (mmap) or the JSON plan, so a
+// repartition only needs the small generated port registry rebuilt. The
+// generated C<output>SimWorkerGenP<ID> remains the faster path.
+class CorvusPlanSimWorker : public CorvusSimWorker {
+public:
+    CorvusPlanSimWorker(CorvusSimWorkerSynctreeEndpoint* simWorkerSynctreeEndpoint,
+                        std::vector<CorvusBusEndpoint*> mBusEndpoints,
+                        std::vector<CorvusBusEndpoint*> sBusEndpoints,
+                        int partitionId,
+                        std::string planPath);
+
+protected:
+    // Construct cModule/sModule and register their ports.
+    virtual void createPlanModules(CorvusPlanPortMap& combPorts, CorvusPlanPortMap& seqPorts) = 0;
+    virtual void deletePlanModules() = 0;
+
+    void createSimModules() override;
+    void deleteSimModules() override;
+    void loadMBusCInputs() override;
+    void loadSBusCInputs() override;
+    void sendMBusCOutputs() override;
+    void copySInputs() override;
+    void sendSBusSOutputs() override;
+    void copyLocalCInputs() override;
+
+private:
+    struct RecvOp {
+        CorvusPlanPort port;
+        int32_t bitOffset = 0;
+        int32_t slotBit = 0;
+        uint64_t packMask = 0;  // != 0 -> packed narrow signal at slotBit
+    };
+    // Receive ops by slot id: ops[slotStart[s] .. slotStart[s + 1]); a slot
+    // has one op, or one per narrow signal packed into it.
+    struct RecvTable {
+        std::vector<uint32_t> slotStart;
+        std::vector<RecvOp> ops;
+    };
+    struct PackField {
+        CorvusPlanPort port;
+        int32_t slotBit = 0;
+        uint64_t mask = 0;
+    };
+    struct SendOp {
+        CorvusPlanPort port;
+        int32_t bitOffset = 0;
+        uint32_t targetId = 0;
+        uint32_t slotId = 0;
+        uint64_t targetMask = 0;  // != 0 -> multicast to these endpoints
+        uint32_t packFirst = 0;   // packCount != 0 -> slice assembled from
+        uint32_t packCount = 0;   // packFields[packFirst, +packCount)
+        int32_t xbusLane = -1;    // >= 0 -> cross-group frame, sent on inter-group lane xbusLane
+    };
+    struct SendTable {
+        std::vector<SendOp> ops;
+        std::vector<PackField> packFields;
+    };
+    struct CopyOp {
+        CorvusPlanPort src;
+        CorvusPlanPort dst;
+    };
+    // Plan as read from disk, before port names are resolved.
+    struct RawRecv { std::string port; int32_t slotId; int32_t bitOffset; int32_t slotBit; int32_t packWidth; };
+    struct RawSend {
+        std::string port;
+        int32_t bitOffset;
+        int32_t targetId;
+        int32_t slotId;
+        int32_t slotBit;
+        int32_t packWidth;
+        uint64_t targetMask;
+    };
+    struct RawPlan {
+        std::vector<RawRecv> loadMBusCInputs;
+        std::vector<RawRecv> loadSBusCInputs;
+        std::vector<RawSend> sendMBusCOutputs;
+        std::vector<std::string> copySInputs;
+        std::vector<RawSend> sendSBusSOutputs;
+        std::vector<std::string> copyLocalCInputs;
+        // Two-level SBus (--partition-groups); xbusCount 0 is the flat SBus.
+        int32_t sbusCount = 0;
+        int32_t xbusCount = 0;
+        std::map<int32_t, int32_t> groups;  // pid -> group of every partition
+    };
+
+    bool loadPlan(RawPlan& plan, std::string& error) const;
+    bool loadBinaryPlan(RawPlan& plan, std::string& error) const;
+    bool loadJsonPlan(RawPlan& plan, std::string& error) const;
+    void compilePlan(const RawPlan& plan);
+    void buildRecvTable(const std::vector<RawRecv>& recs, RecvTable& table);
+    void buildSendTable(const std::vector<RawSend>& recs, const CorvusPlanPortMap& ports,
+                        bool toTop, SendTable& table);
+    void assignXBusLanes(const RawPlan& plan);
+    void buildCopyTable(const std::vector<std::string>& names, const CorvusPlanPortMap& srcPorts,
+                        const CorvusPlanPortMap& dstPorts, std::vector<CopyOp>& table);
+    const CorvusPlanPort& resolve(const CorvusPlanPortMap& ports, const std::string& name,
+                                  const char* module);
+    void drainRecv(std::vector<CorvusBusEndpoint*>& endpoints, const RecvTable& table);
+    // Frames without an xbusLane go round-robin over the first `lanes`
+    // endpoints; inter-group lanes follow them.
+    void runSends(std::vector<CorvusBusEndpoint*>& endpoints, size_t lanes, const SendTable& table);
+    static void runCopies(const std::vector<CopyOp>& table);
+
+    int partitionId;
+    std::string planPath;
+    CorvusPlanPortMap combPorts;
+    CorvusPlanPortMap seqPorts;
+    RecvTable mBusRecvs;
+    RecvTable sBusRecvs;
+    SendTable mBusSends;
+    SendTable sBusSends;
+    size_t sBusLanes = 0;
+    std::vector<CopyOp> cToSCopies;
+    std::vector<CopyOp> sToCCopies;
+};
+
+#endif // CORVUS_PLAN_SIM_WORKER_H
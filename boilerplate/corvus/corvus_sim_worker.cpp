@@ -1,6 +1,7 @@
 #include "corvus_sim_worker.h"
 #include <cstdio>
 #include <iostream>
+#include <stdexcept>
 #include <thread>
 #include <utility>
 
@@ -17,7 +18,9 @@ CorvusSimWorker::~CorvusSimWorker() {
     std::cout << "[CorvusSimWorker] Destructor state: "
               << "name=" << (workerName.empty() ? "<unnamed>" : workerName)
                 << ", loopCount=" << loopCount
-                << ", lastStage=" << lastStage
+                << ", stage=" << (stage == Stage::WAIT_START ? "waiting for start"
+                                  : stage == Stage::WAIT_TOP_SYNC ? "waiting for top sync"
+                                                                  : "waiting for top allow S output")
                 << ", prevTopSyncFlag=" << static_cast<unsigned int>(prevTopSyncFlag.getValue())
                 << ", prevTopAllowSOutputFlag=" << static_cast<unsigned int>(prevTopAllowSOutputFlag.getValue())
                 << ", simWorkerInputReadyFlag=" << static_cast<unsigned int>(simWorkerInputReadyFlag.getValue())
@@ -30,42 +33,109 @@ CorvusSimWorker::~CorvusSimWorker() {
         std::cout << ", synctreeEndpoint=null";
     }
     std::cout << std::endl;
+    dumpTrace();
 }
 
 void CorvusSimWorker::loop() {
     printf("SimWorker(%s) loop started\n", workerName.empty() ? "unnamed" : workerName.c_str());
-    while(!hasStartFlagSeen()){}
     while(loopContinue) {
-        loopCount++;
-        logStage("waiting for top sync");
-        while(loopContinue && !isTopSyncFlagRaised()) {}
-        if (!loopContinue) break;
-        logStage(std::string("get top sync flag as ") + std::to_string(prevTopSyncFlag.getValue()));
+        poll();
+    }
+}
+
+bool CorvusSimWorker::poll() {
+    switch (stage) {
+    case Stage::WAIT_START:
+        if (!hasStartFlagSeen()) return false;
+        beginCycle();
+        return true;
+    case Stage::WAIT_TOP_SYNC:
+        if (syncMode == CorvusSyncMode::DATAFLOW ? !isDataflowReady() : !isTopSyncFlagRaised()) return false;
+        CORVUS_TRACE_RECORD(trace, CorvusTraceStage::WORKER_TOP_SYNC_SEEN, loopCount, prevTopSyncFlag.getValue());
+        enterPhase(CorvusWorkerPhase::LOAD_INPUTS);
+        if (syncMode != CorvusSyncMode::BARRIER) {
+            // Read the half holding last cycle's S outputs; this cycle's go
+            // to the other one.
+            for (auto endpoint : sBusEndpoints) {
+                endpoint->setCycleParity(static_cast<uint32_t>(loopCount & 1));
+            }
+        }
         loadMBusCInputs();
         loadSBusCInputs();
-        logStage("raise sim worker input ready flag");
-        raiseSimWorkerInputReadyFlag();
-        logStage(std::string("sim worker input ready flag raised to ") + std::to_string(simWorkerInputReadyFlag.getValue()));
+        if (syncMode == CorvusSyncMode::BARRIER) {
+            raiseSimWorkerInputReadyFlag();
+            CORVUS_TRACE_RECORD(trace, CorvusTraceStage::WORKER_INPUT_READY_RAISED, loopCount,
+                                simWorkerInputReadyFlag.getValue());
+        }
+        enterPhase(CorvusWorkerPhase::C_EVAL);
         cModule->eval();
+        enterPhase(CorvusWorkerPhase::C_OUTPUTS);
         sendMBusCOutputs();
         copySInputs();
+        enterPhase(CorvusWorkerPhase::S_EVAL);
         sModule->eval();
-        logStage("waiting for top allow S output");
-        while(loopContinue && !isTopAllowSOutputFlagRaised()) {}
-        if (!loopContinue) break;
-        logStage(std::string("get top allow S output flag as ") + std::to_string(prevTopAllowSOutputFlag.getValue()));
-        sendSBusSOutputs();
-        logStage("raise sim worker sync flag");
+        if (syncMode != CorvusSyncMode::BARRIER) {
+            finishCycle();
+            return true;
+        }
+        CORVUS_TRACE_RECORD(trace, CorvusTraceStage::WORKER_WAIT_ALLOW_S_OUTPUT, loopCount,
+                            prevTopAllowSOutputFlag.getValue());
+        stage = Stage::WAIT_ALLOW_S_OUTPUT;
+        enterPhase(CorvusWorkerPhase::IDLE);
+        return true;
+    case Stage::WAIT_ALLOW_S_OUTPUT:
+        if (!isTopAllowSOutputFlagRaised()) return false;
+        CORVUS_TRACE_RECORD(trace, CorvusTraceStage::WORKER_ALLOW_S_OUTPUT_SEEN, loopCount,
+                            prevTopAllowSOutputFlag.getValue());
+        finishCycle();
+        return true;
+    }
+    return false;
+}
+
+void CorvusSimWorker::finishCycle() {
+    enterPhase(CorvusWorkerPhase::S_OUTPUTS);
+    sendSBusSOutputs();
+    if (syncMode == CorvusSyncMode::DATAFLOW) {
+        synctreeEndpoint->setWorkerEpoch(dataflowId, loopCount);
+    } else {
         raiseSimWorkerSyncFlag();
-        logStage(std::string("SimWorkerSync flag raised to ") + std::to_string(simWorkerSyncFlag.getValue()));
-        copyLocalCInputs();
     }
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::WORKER_SYNC_RAISED, loopCount, simWorkerSyncFlag.getValue());
+    copyLocalCInputs();
+    enterPhase(CorvusWorkerPhase::IDLE);
+    beginCycle();
+}
+
+void CorvusSimWorker::beginCycle() {
+    loopCount++;
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::WORKER_WAIT_TOP_SYNC, loopCount, prevTopSyncFlag.getValue());
+    stage = Stage::WAIT_TOP_SYNC;
 }
 
 void CorvusSimWorker::stop() {
     loopContinue = false;
 }
 
+void CorvusSimWorker::resume() {
+    loopContinue = true;
+}
+
+void CorvusSimWorker::restoreCycleState(uint64_t cycles, CorvusSynctreeEndpoint::ValueFlag flag) {
+    loopCount = cycles + 1;
+    stage = Stage::WAIT_TOP_SYNC;
+    simWorkerInputReadyFlag = flag;
+    simWorkerSyncFlag = flag;
+    prevTopSyncFlag = flag;
+    prevTopAllowSOutputFlag = flag;
+    synctreeEndpoint->setSimWorkerInputReadyFlag(flag);
+    synctreeEndpoint->setSimWorkerSyncFlag(flag);
+    if (syncMode == CorvusSyncMode::DATAFLOW) {
+        synctreeEndpoint->setWorkerEpoch(dataflowId, cycles);
+    }
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::RESTORED, loopCount, flag.getValue());
+}
+
 
 void CorvusSimWorker::raiseSimWorkerInputReadyFlag() {
     simWorkerInputReadyFlag.updateToNext();
@@ -80,6 +150,7 @@ bool CorvusSimWorker::isTopAllowSOutputFlagRaised() {
         prevTopAllowSOutputFlag.updateToNext();
         return true;
     } else {
+        dumpTrace();
         while(1){
             std::cerr << "[CorvusSimWorker] Fatal error: unexpected top allow S output flag value="
                     << static_cast<int>(flag.getValue())
@@ -109,6 +180,7 @@ bool CorvusSimWorker::isTopSyncFlagRaised() {
     } else {
         // Unexpected flag value, possibly due to reset
         // 严重错误，终止模拟
+        dumpTrace();
         while(1){
             std::cerr << "[CorvusSimWorker] Fatal error: unexpected top sync flag value="
                     << static_cast<int>(synctreeEndpoint->getTopSyncFlag().getValue())
@@ -120,14 +192,46 @@ bool CorvusSimWorker::isTopSyncFlagRaised() {
     }
 }
 
+void CorvusSimWorker::setDataflowPeers(uint32_t selfId, std::vector<uint32_t> peers) {
+    dataflowId = selfId;
+    dataflowPeers = std::move(peers);
+}
+
+// Cycle n may start once the top has started n - lead and every S->C
+// neighbour has finished n - 1: producers' frames for this cycle are complete,
+// and consumers have drained the half this cycle's S outputs are about to
+// reuse. Only workers fed by the top need the top at n itself.
+bool CorvusSimWorker::isDataflowReady() {
+    if (synctreeEndpoint->getTopEpoch() + dataflowLead < loopCount) return false;
+    for (uint32_t peer : dataflowPeers) {
+        if (synctreeEndpoint->getWorkerEpoch(peer) + 1 < loopCount) return false;
+    }
+    return true;
+}
+
+void CorvusSimWorker::setSyncMode(CorvusSyncMode mode) {
+    if (mode == CorvusSyncMode::DATAFLOW && (!synctreeEndpoint->hasEpochs() || dataflowId == 0)) {
+        throw std::runtime_error("[CorvusSimWorker] dataflow sync needs sync tree epochs and setDataflowPeers()");
+    }
+    if (mode != CorvusSyncMode::BARRIER) {
+        for (auto endpoint : sBusEndpoints) {
+            if (endpoint == nullptr || !endpoint->setCycleParity(0)) {
+                throw std::runtime_error("[CorvusSimWorker] SBus endpoint does not support parity-split buffers");
+            }
+        }
+    }
+    syncMode = mode;
+}
+
 void CorvusSimWorker::setName(std::string name) {
     workerName = std::move(name);
 }
 
-void CorvusSimWorker::logStage(std::string stageLabel) {
-    lastStage = std::move(stageLabel);
-    // printf("SimWorker(%s) loopCount=%llu stage=%s\n",
-    //        workerName.empty() ? "unnamed" : workerName.c_str(),
-    //        static_cast<unsigned long long>(loopCount),
-    //        stageLabel.c_str());
+void CorvusSimWorker::setPhaseObserver(CorvusWorkerPhaseObserver* observer, uint32_t slot) {
+    phaseObserver = observer;
+    phaseSlot = slot;
+}
+
+void CorvusSimWorker::dumpTrace() {
+    CORVUS_TRACE_DUMP(trace, std::cerr, workerName.empty() ? "unnamed" : workerName.c_str());
 }
@@ -1,11 +1,27 @@
 #ifndef CORVUS_SIM_WORKER_H
 #define CORVUS_SIM_WORKER_H
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include "sim_worker.h"
 #include "corvus_bus_endpoint.h"
 #include "corvus_synctree_endpoint.h"
+#include "corvus_trace.h"
+
+// Steps of one worker cycle in the order poll() runs them; IDLE covers the
+// time spent waiting on the sync tree (or on other workers, when pooled).
+enum class CorvusWorkerPhase : uint8_t { LOAD_INPUTS, C_EVAL, C_OUTPUTS, S_EVAL, S_OUTPUTS, IDLE };
+
+// Told on the polling thread each time a worker enters a phase; the worker's
+// previous phase ends at the same point. All phases but IDLE begin and end
+// within one poll() call, so on one thread.
+class CorvusWorkerPhaseObserver {
+    public:
+        virtual ~CorvusWorkerPhaseObserver() = default;
+        virtual void enterPhase(uint32_t slot, CorvusWorkerPhase phase) = 0;
+};
+
 class CorvusSimWorker : public SimWorker {
     public:
         ~CorvusSimWorker() override;
@@ -13,9 +29,40 @@ class CorvusSimWorker : public SimWorker {
                         std::vector<CorvusBusEndpoint*> mBusEndpoints,
                         std::vector<CorvusBusEndpoint*> sBusEndpoints);
         void loop() override;
+        // Advance the cycle state machine as far as the sync flags allow without
+        // waiting; returns false when nothing could be done. loop() spins on it,
+        // CorvusCModelWorkerPool shares threads between many workers with it.
+        // Callers must not poll one worker from two threads at once.
+        bool poll();
         void stop();
+        // Re-arm the loop after stop(); called by the runner before each run.
+        void resume();
+        // Align worker flags with a completed cycle (checkpoint restore).
+        // Only valid while the loop is not running.
+        void restoreCycleState(uint64_t cycles, CorvusSynctreeEndpoint::ValueFlag flag);
+        // Must match CorvusTopModule's mode; set once, before the loop starts.
+        // SBUS_PARITY and DATAFLOW throw std::runtime_error if an SBus endpoint
+        // cannot split its receive buffer by parity; DATAFLOW also needs sync
+        // tree epochs and setDataflowPeers() first.
+        void setSyncMode(CorvusSyncMode mode);
+        // DATAFLOW: this worker's bus endpoint id and those of the workers it
+        // exchanges S->C frames with, in either direction.
+        void setDataflowPeers(uint32_t selfId, std::vector<uint32_t> peers);
+        // DATAFLOW: cycles this worker may run ahead of the top epoch. Keep 0
+        // (the default) for workers exchanging MBus frames with the top; the
+        // others only need their S->C neighbours and may use the top's slack.
+        void setDataflowLead(uint32_t cycles) { dataflowLead = cycles; }
+        // Cycles this worker has finished. Only valid while the loop is not
+        // running; in DATAFLOW it may be ahead of the top by the lead.
+        uint64_t getCompletedCycles() const { return stage == Stage::WAIT_START ? 0 : loopCount - 1; }
+        CorvusSyncMode getSyncMode() const { return syncMode; }
         const std::string& name() const { return workerName; }
         void setName(std::string name);
+        // Report phase boundaries to `observer` under `slot`; nullptr turns it
+        // off. Set before the loop starts.
+        void setPhaseObserver(CorvusWorkerPhaseObserver* observer, uint32_t slot);
+        CorvusWorkerPhaseObserver* getPhaseObserver() const { return phaseObserver; }
+        uint32_t getPhaseSlot() const { return phaseSlot; }
     protected:
         CorvusSimWorkerSynctreeEndpoint* synctreeEndpoint;
         std::vector<CorvusBusEndpoint*> mBusEndpoints;
@@ -28,6 +75,20 @@ class CorvusSimWorker : public SimWorker {
         virtual void sendSBusSOutputs()=0;
         virtual void copyLocalCInputs()=0;
     private:
+        enum class Stage { WAIT_START, WAIT_TOP_SYNC, WAIT_ALLOW_S_OUTPUT };
+        void beginCycle();
+        void finishCycle();
+        bool isDataflowReady();
+        void enterPhase(CorvusWorkerPhase phase) {
+            if (phaseObserver) phaseObserver->enterPhase(phaseSlot, phase);
+        }
+        CorvusWorkerPhaseObserver* phaseObserver = nullptr;
+        uint32_t phaseSlot = 0;
+        Stage stage = Stage::WAIT_START;
+        CorvusSyncMode syncMode = CorvusSyncMode::BARRIER;
+        uint32_t dataflowId = 0;
+        std::vector<uint32_t> dataflowPeers;
+        uint32_t dataflowLead = 0;
         // Compatibility helpers for the newer sync flow; implemented using legacy hooks.
         bool hasStartFlagSeen();
         bool isTopSyncFlagRaised();
@@ -38,10 +99,12 @@ class CorvusSimWorker : public SimWorker {
         CorvusSynctreeEndpoint::ValueFlag simWorkerSyncFlag;
         CorvusSynctreeEndpoint::ValueFlag prevTopSyncFlag;
         CorvusSynctreeEndpoint::ValueFlag prevTopAllowSOutputFlag;
-        std::string lastStage = "init";
         std::string workerName;
         bool loopContinue;
-        void logStage(std::string stageLabel);
+#ifdef CORVUS_TRACE
+        CorvusTraceRing trace;
+#endif
+        void dumpTrace();
 };
 
 #endif
@@ -3,6 +3,20 @@
 
 #include <cstdint>
 
+// Cycle protocol between CorvusTopModule and its CorvusSimWorkers.
+//   BARRIER: top sync -> input ready -> allow S output -> worker sync. S->C
+//     frames are sent only after every worker has drained this cycle's inputs.
+//   SBUS_PARITY: top sync -> worker sync. SBus frames carry the sender's cycle
+//     parity and receivers read only last cycle's half of their buffer, so S
+//     outputs are sent as soon as sModule->eval() returns.
+//   DATAFLOW: no global barrier. SBus is parity-split as above; the top and
+//     every worker publish a 64-bit epoch (last cycle started by the top,
+//     last cycle finished by a worker). A worker starts cycle n once each S->C
+//     neighbour finished n - 1 and the top started n - lead (lead 0 for the
+//     workers exchanging MBus frames with the top, which are the only ones
+//     the top waits for).
+enum class CorvusSyncMode : uint8_t { BARRIER, SBUS_PARITY, DATAFLOW };
+
 class CorvusSynctreeEndpoint
 {
 public:
@@ -52,6 +66,11 @@ public:
     virtual void setTopAllowSOutputFlag(ValueFlag flag) = 0;
     virtual void setTopSyncFlag(ValueFlag flag) = 0;
     virtual void setSimWorkerStartFlag(ValueFlag flag) = 0;
+    // Epochs for CorvusSyncMode::DATAFLOW, workers addressed by bus endpoint
+    // id (partition id + 1). Unsupported unless hasEpochs() is overridden.
+    virtual bool hasEpochs() const { return false; }
+    virtual void setTopEpoch(uint64_t epoch) { (void)epoch; }
+    virtual uint64_t getWorkerEpoch(uint32_t endpointId) { (void)endpointId; return 0; }
 };
 
 class CorvusSimWorkerSynctreeEndpoint : public CorvusSynctreeEndpoint
@@ -64,5 +83,10 @@ public:
     virtual void setSimWorkerInputReadyFlag(ValueFlag flag) = 0;
     virtual ValueFlag getTopAllowSOutputFlag() = 0;
     virtual void setSimWorkerSyncFlag(ValueFlag flag) = 0;
+    // See CorvusTopSynctreeEndpoint: epochs for CorvusSyncMode::DATAFLOW.
+    virtual bool hasEpochs() const { return false; }
+    virtual uint64_t getTopEpoch() { return 0; }
+    virtual uint64_t getWorkerEpoch(uint32_t endpointId) { (void)endpointId; return 0; }
+    virtual void setWorkerEpoch(uint32_t endpointId, uint64_t epoch) { (void)endpointId; (void)epoch; }
 };
 #endif
\ No newline at end of file
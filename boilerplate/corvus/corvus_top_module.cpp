@@ -2,6 +2,7 @@
 #include <utility>
 #include <iostream>
 #include <cstdint>
+#include <stdexcept>
 
 
 CorvusTopModule::CorvusTopModule(CorvusTopSynctreeEndpoint* topSynctreeEndpoint,
@@ -16,7 +17,6 @@ CorvusTopModule::~CorvusTopModule() {
               << ", topAllowSOutputFlag=" << static_cast<unsigned int>(topAllowSOutputFlag.getValue())
               << ", prevSimWorkerInputReadyFlag=" << static_cast<unsigned int>(prevSimWorkerInputReadyFlag.getValue())
               << ", prevSimWorkerSyncFlag=" << static_cast<unsigned int>(prevSimWorkerSyncFlag.getValue())
-              << ", lastStage=" << lastStage
               << ", evalCount=" << evalCount
               << std::endl;
 
@@ -30,37 +30,100 @@ CorvusTopModule::~CorvusTopModule() {
     } else {
         std::cout << "[CorvusTopModule] Synctree endpoint is null at teardown" << std::endl;
     }
+    dumpTrace();
 }
 
 void CorvusTopModule::prepareSimWorker() {
     synctreeEndpoint->setSimWorkerStartFlag(CorvusSynctreeEndpoint::ValueFlag::START_GUARD);
 }
 
+void CorvusTopModule::setSyncMode(CorvusSyncMode mode) {
+    if (mode == CorvusSyncMode::DATAFLOW && !synctreeEndpoint->hasEpochs()) {
+        throw std::runtime_error("[CorvusTopModule] sync tree does not provide dataflow epochs");
+    }
+    syncMode = mode;
+}
+
+void CorvusTopModule::setDataflowWorkers(std::vector<uint32_t> workers, std::vector<uint32_t> topWorkers) {
+    dataflowWorkers = std::move(workers);
+    dataflowTopWorkers = std::move(topWorkers);
+}
+
 void CorvusTopModule::eval() {
+    if (syncMode == CorvusSyncMode::DATAFLOW) {
+        evalDataflow();
+        return;
+    }
     evalCount++;
-    logStage("eval_start");
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_EVAL_START, evalCount, topSyncFlag.getValue());
     sendIAndEOutput();
-    logStage("waiting for bus clear");
     while(!synctreeEndpoint->isMBusClear() || !synctreeEndpoint->isSBusClear()) {}
-    logStage("raise top sync flag");
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_BUS_CLEAR, evalCount, topSyncFlag.getValue());
     raiseTopSyncFlag();
-    logStage(std::string("top sync flag raised to ") + std::to_string(topSyncFlag.getValue()));
-    logStage("waiting for sim worker input ready");
-    while(!isSimWorkerInputReadyFlagRaised()) {}
-    logStage(std::string("get sim worker input ready flag as ") + std::to_string(prevSimWorkerInputReadyFlag.getValue()));
-    logStage("raise top allow S output flag");
-    raiseTopAllowSOutputFlag();
-    logStage(std::string("top allow S output flag raised to ") + std::to_string(topAllowSOutputFlag.getValue()));
-    logStage("waiting for S finish");
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_SYNC_RAISED, evalCount, topSyncFlag.getValue());
+    if (syncMode == CorvusSyncMode::BARRIER) {
+        while(!isSimWorkerInputReadyFlagRaised()) {}
+        CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_INPUT_READY_SEEN, evalCount,
+                            prevSimWorkerInputReadyFlag.getValue());
+        raiseTopAllowSOutputFlag();
+        CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_ALLOW_S_OUTPUT_RAISED, evalCount,
+                            topAllowSOutputFlag.getValue());
+    }
     while(!synctreeEndpoint->isMBusClear() || !isSimWorkerSyncFlagRaised()) {}
-    logStage(std::string("get sim worker sync flag as ") + std::to_string(prevSimWorkerSyncFlag.getValue()));
-    logStage("S finish detected");
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_WORKER_SYNC_SEEN, evalCount, prevSimWorkerSyncFlag.getValue());
+    loadOAndEInput();
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_EVAL_DONE, evalCount, topSyncFlag.getValue());
+}
+
+// Workers without top traffic are only held back by their S->C neighbours and
+// their lead over the top epoch; the lag bound keeps them within
+// dataflowSlack cycles behind it.
+void CorvusTopModule::evalDataflow() {
+    evalCount++;
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_EVAL_START, evalCount, 0);
+    sendIAndEOutput();
+    while(!synctreeEndpoint->isMBusClear() || !synctreeEndpoint->isSBusClear()) {}
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_BUS_CLEAR, evalCount, 0);
+    if (evalCount > dataflowSlack + 1) {
+        while(!workersReached(dataflowWorkers, evalCount - dataflowSlack - 1)) {}
+    }
+    synctreeEndpoint->setTopEpoch(evalCount);
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_SYNC_RAISED, evalCount, 0);
+    while(!synctreeEndpoint->isMBusClear() || !workersReached(dataflowTopWorkers, evalCount)) {}
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_WORKER_SYNC_SEEN, evalCount, 0);
     loadOAndEInput();
-    logStage("eval_done");
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::TOP_EVAL_DONE, evalCount, 0);
+}
+
+bool CorvusTopModule::workersReached(const std::vector<uint32_t>& workers, uint64_t epoch) {
+    for (uint32_t id : workers) {
+        if (synctreeEndpoint->getWorkerEpoch(id) < epoch) return false;
+    }
+    return true;
+}
+
+void CorvusTopModule::settle() {
+    if (syncMode != CorvusSyncMode::DATAFLOW) return;
+    while(!workersReached(dataflowWorkers, evalCount)) {}
+}
+
+void CorvusTopModule::restoreCycleState(uint64_t evalCount, CorvusSynctreeEndpoint::ValueFlag flag) {
+    this->evalCount = evalCount;
+    topSyncFlag = flag;
+    topAllowSOutputFlag = flag;
+    prevSimWorkerInputReadyFlag = flag;
+    prevSimWorkerSyncFlag = flag;
+    synctreeEndpoint->setTopSyncFlag(flag);
+    synctreeEndpoint->setTopAllowSOutputFlag(flag);
+    if (syncMode == CorvusSyncMode::DATAFLOW) {
+        synctreeEndpoint->setTopEpoch(evalCount);
+    }
+    CORVUS_TRACE_RECORD(trace, CorvusTraceStage::RESTORED, evalCount, flag.getValue());
 }
 
 void CorvusTopModule::evalE() {
-    eModule->eval();
+    // Designs without a corvus_external module have no eModule.
+    if (eModule) eModule->eval();
 }
 
 bool CorvusTopModule::isSimWorkerSyncFlagRaised() {
@@ -74,6 +137,7 @@ bool CorvusTopModule::isSimWorkerSyncFlagRaised() {
         return true;
     } else {
         // 丢步，严重错误
+        dumpTrace();
         while(1) {
             std::cerr << "[CorvusTopModule] Fatal error: SimWorkerSyncFlag finish flag jumped from "
                     << static_cast<int>(prevSimWorkerSyncFlag.getValue()) << " to "
@@ -94,6 +158,7 @@ bool CorvusTopModule::isSimWorkerInputReadyFlagRaised() {
         return true;
     } else {
         // 丢步，严重错误
+        dumpTrace();
         while(1) {
             std::cerr << "[CorvusTopModule] Fatal error: SimWorkerInputReadyFlag finish flag jumped from "
                     << static_cast<int>(prevSimWorkerInputReadyFlag.getValue()) << " to "
@@ -122,9 +187,6 @@ void CorvusTopModule::clearMBusRecvBuffer() {
 }
 
 
-void CorvusTopModule::logStage(std::string stageLabel) {
-    // lastStage = stageLabel;
-    // printf("TopModule evalCount=%llu stage=%s\n",
-    //        static_cast<unsigned long long>(evalCount),
-    //        stageLabel.c_str());
+void CorvusTopModule::dumpTrace() {
+    CORVUS_TRACE_DUMP(trace, std::cerr, "TopModule");
 }
@@ -7,6 +7,7 @@
 #include "top_module.h"
 #include "corvus_bus_endpoint.h"
 #include "corvus_synctree_endpoint.h"
+#include "corvus_trace.h"
 
 class CorvusTopModule : public TopModule {
 public:
@@ -16,6 +17,25 @@ public:
     void prepareSimWorker() override;
     void eval() override;
     void evalE() override;
+    uint64_t getEvalCount() const { return evalCount; }
+    // Must match the mode of every CorvusSimWorker; set before the first eval().
+    // DATAFLOW throws std::runtime_error if the sync tree has no epochs.
+    void setSyncMode(CorvusSyncMode mode);
+    CorvusSyncMode getSyncMode() const { return syncMode; }
+    // DATAFLOW: endpoint ids of all workers and of those exchanging MBus
+    // frames with the top (eval() waits for the latter only).
+    void setDataflowWorkers(std::vector<uint32_t> workers, std::vector<uint32_t> topWorkers);
+    // DATAFLOW: cycles a worker without top traffic may trail the top before
+    // eval() waits for it.
+    void setDataflowSlack(uint32_t cycles) { dataflowSlack = cycles; }
+    // Wait until every worker has finished the last evaluated cycle (no-op
+    // outside DATAFLOW, where eval() already does). Workers must be running.
+    void settle();
+    // Flag value shared by every sync flag once a cycle has completed.
+    CorvusSynctreeEndpoint::ValueFlag getCycleFlag() const { return topSyncFlag; }
+    // Put top-side flags back to a completed-cycle state (checkpoint restore).
+    // Workers must be stopped and restored to the same flag.
+    void restoreCycleState(uint64_t evalCount, CorvusSynctreeEndpoint::ValueFlag flag);
 
 protected:
     CorvusTopSynctreeEndpoint* synctreeEndpoint = nullptr;
@@ -25,17 +45,25 @@ protected:
     uint64_t evalCount = 0;
 
 private:
+    CorvusSyncMode syncMode = CorvusSyncMode::BARRIER;
+    std::vector<uint32_t> dataflowWorkers;
+    std::vector<uint32_t> dataflowTopWorkers;
+    uint32_t dataflowSlack = 2;
     CorvusSynctreeEndpoint::ValueFlag prevSimWorkerInputReadyFlag;
     CorvusSynctreeEndpoint::ValueFlag prevSimWorkerSyncFlag;
     CorvusSynctreeEndpoint::ValueFlag topSyncFlag;
     CorvusSynctreeEndpoint::ValueFlag topAllowSOutputFlag;
-    std::string lastStage = "init";
+#ifdef CORVUS_TRACE
+    CorvusTraceRing trace;
+#endif
     bool isSimWorkerInputReadyFlagRaised();
     bool isSimWorkerSyncFlagRaised();
+    bool workersReached(const std::vector<uint32_t>& workers, uint64_t epoch);
+    void evalDataflow();
     void raiseTopSyncFlag();
     void raiseTopAllowSOutputFlag();
     void clearMBusRecvBuffer();
-    void logStage(std::string stageLabel);
+    void dumpTrace();
 };
 
 #endif
@@ -0,0 +1,102 @@
+#ifndef CORVUS_TRACE_H
+#define CORVUS_TRACE_H
+
+#include <cstdint>
+#include <ostream>
+
+// Sync-flow stages recorded by CorvusTopModule and CorvusSimWorker.
+enum class CorvusTraceStage : uint8_t {
+    TOP_EVAL_START,
+    TOP_BUS_CLEAR,
+    TOP_SYNC_RAISED,
+    TOP_INPUT_READY_SEEN,
+    TOP_ALLOW_S_OUTPUT_RAISED,
+    TOP_WORKER_SYNC_SEEN,
+    TOP_EVAL_DONE,
+    WORKER_WAIT_TOP_SYNC,
+    WORKER_TOP_SYNC_SEEN,
+    WORKER_INPUT_READY_RAISED,
+    WORKER_WAIT_ALLOW_S_OUTPUT,
+    WORKER_ALLOW_S_OUTPUT_SEEN,
+    WORKER_SYNC_RAISED,
+    RESTORED,
+};
+
+inline const char* corvusTraceStageName(CorvusTraceStage stage) {
+    switch (stage) {
+    case CorvusTraceStage::TOP_EVAL_START: return "eval_start";
+    case CorvusTraceStage::TOP_BUS_CLEAR: return "bus clear";
+    case CorvusTraceStage::TOP_SYNC_RAISED: return "top sync flag raised";
+    case CorvusTraceStage::TOP_INPUT_READY_SEEN: return "sim worker input ready seen";
+    case CorvusTraceStage::TOP_ALLOW_S_OUTPUT_RAISED: return "top allow S output flag raised";
+    case CorvusTraceStage::TOP_WORKER_SYNC_SEEN: return "sim worker sync seen";
+    case CorvusTraceStage::TOP_EVAL_DONE: return "eval_done";
+    case CorvusTraceStage::WORKER_WAIT_TOP_SYNC: return "waiting for top sync";
+    case CorvusTraceStage::WORKER_TOP_SYNC_SEEN: return "top sync flag seen";
+    case CorvusTraceStage::WORKER_INPUT_READY_RAISED: return "sim worker input ready flag raised";
+    case CorvusTraceStage::WORKER_WAIT_ALLOW_S_OUTPUT: return "waiting for top allow S output";
+    case CorvusTraceStage::WORKER_ALLOW_S_OUTPUT_SEEN: return "top allow S output flag seen";
+    case CorvusTraceStage::WORKER_SYNC_RAISED: return "sim worker sync flag raised";
+    case CorvusTraceStage::RESTORED: return "restored";
+    }
+    return "unknown";
+}
+
+// Define CORVUS_TRACE (identically in every translation unit, it changes the
+// layout of CorvusTopModule/CorvusSimWorker) to keep the last
+// CORVUS_TRACE_DEPTH stage events of each top/worker in a fixed binary ring.
+// Without it CORVUS_TRACE_RECORD/CORVUS_TRACE_DUMP expand to nothing and the
+// arguments are not evaluated.
+#ifdef CORVUS_TRACE
+
+#ifndef CORVUS_TRACE_DEPTH
+#define CORVUS_TRACE_DEPTH 256
+#endif
+
+// Single writer: the owning top/worker is driven by one thread at a time.
+class CorvusTraceRing {
+public:
+    static_assert((CORVUS_TRACE_DEPTH & (CORVUS_TRACE_DEPTH - 1)) == 0 && CORVUS_TRACE_DEPTH > 0,
+                  "CORVUS_TRACE_DEPTH must be a power of two");
+
+    void record(CorvusTraceStage stage, uint64_t cycle, uint8_t flag) {
+        Event& e = events[head++ & (CORVUS_TRACE_DEPTH - 1)];
+        e.cycle = cycle;
+        e.stage = stage;
+        e.flag = flag;
+    }
+
+    // Oldest event first.
+    void dump(std::ostream& os, const char* owner) const {
+        const uint64_t count = head < CORVUS_TRACE_DEPTH ? head : CORVUS_TRACE_DEPTH;
+        os << "[CorvusTrace] " << owner << ": last " << count << " of " << head << " events\n";
+        for (uint64_t i = head - count; i < head; ++i) {
+            const Event& e = events[i & (CORVUS_TRACE_DEPTH - 1)];
+            os << "  cycle=" << e.cycle << " stage=" << corvusTraceStageName(e.stage)
+               << " flag=" << static_cast<unsigned int>(e.flag) << "\n";
+        }
+        os.flush();
+    }
+
+private:
+    struct Event {
+        uint64_t cycle;
+        CorvusTraceStage stage;
+        uint8_t flag;
+    };
+    Event events[CORVUS_TRACE_DEPTH] = {};
+    uint64_t head = 0;
+};
+
+#define CORVUS_TRACE_RECORD(ring, stage, cycle, flag) \
+    (ring).record((stage), (cycle), static_cast<uint8_t>(flag))
+#define CORVUS_TRACE_DUMP(ring, os, owner) (ring).dump((os), (owner))
+
+#else
+
+#define CORVUS_TRACE_RECORD(ring, stage, cycle, flag) ((void)0)
+#define CORVUS_TRACE_DUMP(ring, os, owner) ((void)0)
+
+#endif // CORVUS_TRACE
+
+#endif // CORVUS_TRACE_H
@@ -0,0 +1,86 @@
+#include "corvus_cmodel_affinity.h"
+
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace {
+#ifdef __linux__
+bool allowedCores(std::vector<uint32_t>& cores) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) != 0) return false;
+    cores.clear();
+    for (uint32_t c = 0; c < CPU_SETSIZE; ++c) {
+        if (CPU_ISSET(c, &set)) cores.push_back(c);
+    }
+    return true;
+}
+#endif
+} // namespace
+
+std::vector<CorvusCModelCoreSet> corvusCModelPlanCores(const std::vector<uint32_t>& threadsPerWorker,
+                                                       uint32_t reservedCores) {
+    std::vector<uint32_t> cores;
+#ifdef __linux__
+    if (!allowedCores(cores)) {
+        throw std::runtime_error("[CorvusCModel] sched_getaffinity failed; cannot pin partitions");
+    }
+#else
+    throw std::runtime_error("[CorvusCModel] core pinning is only supported on Linux");
+#endif
+    size_t needed = reservedCores;
+    for (uint32_t t : threadsPerWorker) {
+        needed += t > 0 ? t : 1;
+    }
+    if (needed > cores.size()) {
+        throw std::runtime_error("[CorvusCModel] pinning needs " + std::to_string(needed) +
+                                 " cores (" + std::to_string(reservedCores) + " reserved) but only " +
+                                 std::to_string(cores.size()) + " are available");
+    }
+    std::vector<CorvusCModelCoreSet> sets(threadsPerWorker.size());
+    size_t next = reservedCores;
+    for (size_t i = 0; i < threadsPerWorker.size(); ++i) {
+        const uint32_t t = threadsPerWorker[i] > 0 ? threadsPerWorker[i] : 1;
+        sets[i].workerCore = cores[next++];
+        for (uint32_t k = 1; k < t; ++k) {
+            sets[i].helperCores.push_back(cores[next++]);
+        }
+    }
+    return sets;
+}
+
+bool corvusCModelSetThreadAffinity(const std::vector<uint32_t>& cores) {
+#ifdef __linux__
+    if (cores.empty()) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (uint32_t c : cores) {
+        if (c >= CPU_SETSIZE) return false;
+        CPU_SET(c, &set);
+    }
+    // pid 0 addresses the calling thread.
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cores;
+    return false;
+#endif
+}
+
+CorvusCModelScopedAffinity::CorvusCModelScopedAffinity(const std::vector<uint32_t>& cores) {
+#ifdef __linux__
+    if (cores.empty() || !allowedCores(saved)) return;
+    active = corvusCModelSetThreadAffinity(cores);
+#else
+    (void)cores;
+#endif
+}
+
+CorvusCModelScopedAffinity::~CorvusCModelScopedAffinity() {
+    if (active) {
+        corvusCModelSetThreadAffinity(saved);
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef CORVUS_CMODEL_AFFINITY_H
+#define CORVUS_CMODEL_AFFINITY_H
+
+#include <cstdint>
+#include <vector>
+
+// Cores reserved for one partition: its SimWorker thread runs on workerCore,
+// the helper threads of its Verilator --threads models on helperCores.
+struct CorvusCModelCoreSet {
+    uint32_t workerCore = 0;
+    std::vector<uint32_t> helperCores;
+};
+
+// Split the CPUs this process may run on into disjoint per-worker sets, in
+// worker order: worker i gets threadsPerWorker[i] cores (at least one). The
+// first `reservedCores` allowed CPUs are left to the caller (the thread that
+// runs the top eval()). Throws std::runtime_error when the CPUs do not
+// suffice or affinity is unsupported on this platform.
+std::vector<CorvusCModelCoreSet> corvusCModelPlanCores(const std::vector<uint32_t>& threadsPerWorker,
+                                                       uint32_t reservedCores);
+
+// Restrict the calling thread to `cores`; false if that is not possible.
+bool corvusCModelSetThreadAffinity(const std::vector<uint32_t>& cores);
+
+// Restricts the calling thread to `cores` for the lifetime of the object, so
+// threads spawned meanwhile (Verilator's thread pool, created while its model
+// is constructed) inherit the set. An empty set changes nothing.
+class CorvusCModelScopedAffinity {
+public:
+    explicit CorvusCModelScopedAffinity(const std::vector<uint32_t>& cores);
+    ~CorvusCModelScopedAffinity();
+    CorvusCModelScopedAffinity(const CorvusCModelScopedAffinity&) = delete;
+    CorvusCModelScopedAffinity& operator=(const CorvusCModelScopedAffinity&) = delete;
+
+private:
+    std::vector<uint32_t> saved;
+    bool active = false;
+};
+
+#endif // CORVUS_CMODEL_AFFINITY_H
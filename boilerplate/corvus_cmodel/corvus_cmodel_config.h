@@ -0,0 +1,43 @@
+#ifndef CORVUS_CMODEL_CONFIG_H
+#define CORVUS_CMODEL_CONFIG_H
+
+#include <cstdint>
+#include <map>
+
+class VerilatedContext;
+class CorvusCModelWorkerPool;
+class CorvusCModelTimingModel;
+class CorvusCModelPerfCounters;
+class CorvusCModelMetricsPage;
+
+// Per-instance options for a generated C<output>CModelGen.
+struct CorvusCModelConfig {
+    // Shared pool that drives this instance's workers; nullptr -> one
+    // dedicated thread per partition (CorvusCModelSimWorkerRunner).
+    CorvusCModelWorkerPool* workerPool = nullptr;
+    // With CORVUS_CMODEL_CONTEXT: context for every model of the instance;
+    // nullptr -> the instance creates and owns its own VerilatedContext.
+    VerilatedContext* verilatedContext = nullptr;
+    // Partitions whose models were verilated with --threads N, keyed by
+    // partition id. With CORVUS_CMODEL_CONTEXT each gets its own
+    // VerilatedContext sized to N threads instead of sharing one pool.
+    std::map<uint32_t, uint32_t> partitionThreads;
+    // Give every partition a disjoint core set (1 core, or N for the entries
+    // above): the worker thread runs on the first, Verilator's helper threads
+    // on the rest. The first reservedCores CPUs stay with the eval() caller.
+    // Worker threads are only pinned without a workerPool.
+    bool pinCores = false;
+    uint32_t reservedCores = 1;
+    // Build CorvusCModelTimedBus lanes that feed this model, which then
+    // estimates hardware cycles per eval(); nullptr -> idealized buses only.
+    // Use one model per instance.
+    CorvusCModelTimingModel* busTiming = nullptr;
+    // Count cycles, instructions, LLC and branch misses per partition and
+    // worker phase; nullptr -> no phase hooks. Use one instance per model.
+    CorvusCModelPerfCounters* perfCounters = nullptr;
+    // Publish live progress (cycles, rate, worker phase times, bus backlogs)
+    // in a shared-memory page for corvus_top; nullptr -> nothing published.
+    CorvusCModelMetricsPage* metrics = nullptr;
+};
+
+#endif // CORVUS_CMODEL_CONFIG_H
@@ -33,6 +33,27 @@ void CorvusCModelIdealizedBus::deliver(uint32_t targetId, uint64_t payload) {
     target->enqueue(payload);
 }
 
+void CorvusCModelIdealizedBus::route(uint32_t sourceId, uint32_t targetId, uint64_t payload) {
+    (void)sourceId;
+    deliver(targetId, payload);
+}
+
+void CorvusCModelIdealizedBus::routeMulticast(uint32_t sourceId, uint64_t targetMask, uint64_t payload) {
+    (void)sourceId;
+    for (uint32_t id = 0; targetMask != 0; ++id, targetMask >>= 1) {
+        if (targetMask & 1ULL) deliver(id, payload);
+    }
+}
+
+uint32_t CorvusCModelIdealizedBus::takePeakBacklog() {
+    uint32_t peak = 0;
+    for (auto& endpoint : endpoints) {
+        const uint32_t backlog = endpoint->takePeakBacklog();
+        if (backlog > peak) peak = backlog;
+    }
+    return peak;
+}
+
 CorvusCModelIdealizedBusEndpoint::CorvusCModelIdealizedBusEndpoint(CorvusCModelIdealizedBus* bus, uint32_t endpointId)
     : bus(bus), id(endpointId) {}
 
@@ -40,31 +61,63 @@ void CorvusCModelIdealizedBusEndpoint::send(uint32_t targetId, uint64_t payload)
     if (bus == nullptr) {
         throw std::runtime_error("Bus is not available");
     }
-    bus->deliver(targetId, payload);
+    bus->route(id, targetId, payload | sendTag);
+}
+
+void CorvusCModelIdealizedBusEndpoint::sendMulticast(uint64_t targetMask, uint64_t payload) {
+    if (bus == nullptr) {
+        throw std::runtime_error("Bus is not available");
+    }
+    bus->routeMulticast(id, targetMask, payload | sendTag);
 }
 
 uint64_t CorvusCModelIdealizedBusEndpoint::recv() {
     std::lock_guard<std::mutex> lock(bufferMutex);
+    std::deque<uint64_t>& buffer = buffers[readBuffer];
     if (buffer.empty()) {
         // 报错
         throw std::out_of_range("read empty buffer!");
     }
     uint64_t payload = buffer.front();
     buffer.pop_front();
-    return payload;
+    return payload & ~kCorvusBusParityBit;
 }
 
 int CorvusCModelIdealizedBusEndpoint::bufferCnt() const {
     std::lock_guard<std::mutex> lock(bufferMutex);
-    return static_cast<int>(buffer.size());
+    return static_cast<int>(buffers[readBuffer].size());
 }
 
 void CorvusCModelIdealizedBusEndpoint::clearBuffer() {
     std::lock_guard<std::mutex> lock(bufferMutex);
-    buffer.clear();
+    buffers[0].clear();
+    buffers[1].clear();
+}
+
+bool CorvusCModelIdealizedBusEndpoint::setCycleParity(uint32_t parity) {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    readBuffer = (parity & 1U) ^ 1U;
+    sendTag = (parity & 1U) ? kCorvusBusParityBit : 0;
+    return true;
+}
+
+std::vector<uint64_t> CorvusCModelIdealizedBusEndpoint::snapshotBuffer() const {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    std::vector<uint64_t> payloads(buffers[0].begin(), buffers[0].end());
+    payloads.insert(payloads.end(), buffers[1].begin(), buffers[1].end());
+    return payloads;
+}
+
+uint32_t CorvusCModelIdealizedBusEndpoint::takePeakBacklog() {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    const uint32_t peak = peakBacklog;
+    peakBacklog = static_cast<uint32_t>(buffers[0].size() + buffers[1].size());
+    return peak;
 }
 
 void CorvusCModelIdealizedBusEndpoint::enqueue(uint64_t payload) {
     std::lock_guard<std::mutex> lock(bufferMutex);
-    buffer.push_back(payload);
+    buffers[payload >> 63].push_back(payload);
+    const uint32_t backlog = static_cast<uint32_t>(buffers[0].size() + buffers[1].size());
+    if (backlog > peakBacklog) peakBacklog = backlog;
 }
@@ -18,7 +18,7 @@ class CorvusCModelIdealizedBusEndpoint;
 class CorvusCModelIdealizedBus {
 public:
     explicit CorvusCModelIdealizedBus(uint32_t endpointCount);
-    ~CorvusCModelIdealizedBus();
+    virtual ~CorvusCModelIdealizedBus();
     CorvusCModelIdealizedBus(const CorvusCModelIdealizedBus&) = delete;
     CorvusCModelIdealizedBus& operator=(const CorvusCModelIdealizedBus&) = delete;
 
@@ -26,6 +26,13 @@ public:
     const std::vector<std::shared_ptr<CorvusCModelIdealizedBusEndpoint>>& getEndpoints() const;
     uint32_t getEndpointCount() const;
     void deliver(uint32_t targetId, uint64_t payload);
+    // Entry point of every endpoint send(); timed variants observe the frame
+    // here before delivering it.
+    virtual void route(uint32_t sourceId, uint32_t targetId, uint64_t payload);
+    // Entry point of sendMulticast(): one frame, delivered to every target.
+    virtual void routeMulticast(uint32_t sourceId, uint64_t targetMask, uint64_t payload);
+    // Most frames buffered at any one endpoint since the previous call.
+    uint32_t takePeakBacklog();
 
 private:
     std::vector<std::shared_ptr<CorvusCModelIdealizedBusEndpoint>> endpoints;
@@ -35,15 +42,25 @@ class CorvusCModelIdealizedBusEndpoint : public CorvusBusEndpoint {
 public:
     // Each endpoint owns a receive buffer; send routes via bus, recv pops or
     // returns 0 if empty. Both writes and reads are locked to avoid races.
+    // The buffer is split in two halves by the parity bit of each payload;
+    // without setCycleParity() every payload lands in (and is read from) half 0.
     CorvusCModelIdealizedBusEndpoint(CorvusCModelIdealizedBus* bus, uint32_t endpointId);
     ~CorvusCModelIdealizedBusEndpoint() override = default;
     CorvusCModelIdealizedBusEndpoint(const CorvusCModelIdealizedBusEndpoint&) = delete;
     CorvusCModelIdealizedBusEndpoint& operator=(const CorvusCModelIdealizedBusEndpoint&) = delete;
 
     void send(uint32_t targetId, uint64_t payload) override;
+    void sendMulticast(uint64_t targetMask, uint64_t payload) override;
     uint64_t recv() override;
     int bufferCnt() const override;
     void clearBuffer() override;
+    bool setCycleParity(uint32_t parity) override;
+    // Copy of the pending payloads with their parity tags, half 0 first, each
+    // oldest first (used for checkpoints; the bus refills a buffer through
+    // deliver(), which splits it again).
+    std::vector<uint64_t> snapshotBuffer() const;
+    // Most frames buffered (both halves) since the previous call.
+    uint32_t takePeakBacklog();
 
 private:
     friend class CorvusCModelIdealizedBus;
@@ -51,7 +68,10 @@ private:
 
     CorvusCModelIdealizedBus* bus;
     uint32_t id;
-    std::deque<uint64_t> buffer;
+    std::deque<uint64_t> buffers[2];
+    uint32_t readBuffer = 0;
+    uint64_t sendTag = 0;
+    uint32_t peakBacklog = 0;
     mutable std::mutex bufferMutex;
 };
 
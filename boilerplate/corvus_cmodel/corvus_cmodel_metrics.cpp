@@ -0,0 +1,188 @@
+#include "corvus_cmodel_metrics.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+static_assert(static_cast<uint32_t>(CorvusWorkerPhase::IDLE) == corvus_metrics::PHASE_IDLE,
+              "corvus_metrics::Phase must follow CorvusWorkerPhase");
+
+uint64_t nowNanos() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void copyName(char (&dst)[corvus_metrics::kNameLength], const std::string& src) {
+    const size_t n = src.size() < sizeof(dst) - 1 ? src.size() : sizeof(dst) - 1;
+    std::memcpy(dst, src.data(), n);
+    dst[n] = '\0';
+}
+
+// True when `name` holds a metrics page whose publisher no longer runs;
+// anything else (a live run, a page still being created, a foreign object)
+// is left alone.
+bool isStalePage(const std::string& name) {
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) return false;
+    struct stat st;
+    void* mem = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(corvus_metrics::Page)) {
+        mem = mmap(nullptr, sizeof(corvus_metrics::Page), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mem == MAP_FAILED) return false;
+    const corvus_metrics::Page* page = static_cast<const corvus_metrics::Page*>(mem);
+    const bool stale = corvus_metrics::valid(*page) && kill(page->header.pid, 0) != 0 && errno == ESRCH;
+    munmap(mem, sizeof(corvus_metrics::Page));
+    return stale;
+}
+
+// Single writer per counter, so a relaxed load + store is enough.
+void add(std::atomic<uint64_t>& counter, uint64_t delta) {
+    counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+} // namespace
+
+CorvusCModelMetricsPage::CorvusCModelMetricsPage(const std::string& name) : name(name) {
+    if (name.size() < 2 || name[0] != '/' || name.find('/', 1) != std::string::npos) {
+        throw std::runtime_error("[CorvusCModelMetrics] shared-memory name must look like /name: " + name);
+    }
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST && isStalePage(name)) {
+        // Left behind by a run that died without unlinking it.
+        shm_unlink(name.c_str());
+        fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+    if (fd < 0 && errno == EEXIST) {
+        throw std::runtime_error("[CorvusCModelMetrics] " + name +
+                                 " is in use by a running process (or is not a metrics page); pick another name");
+    }
+    if (fd < 0) {
+        throw std::runtime_error("[CorvusCModelMetrics] shm_open(" + name + ") failed: " + std::strerror(errno));
+    }
+    void* mem = MAP_FAILED;
+    if (ftruncate(fd, sizeof(corvus_metrics::Page)) == 0) {
+        mem = mmap(nullptr, sizeof(corvus_metrics::Page), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    const int err = errno;
+    close(fd);
+    if (mem == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        throw std::runtime_error("[CorvusCModelMetrics] mapping " + name + " failed: " + std::strerror(err));
+    }
+    // ftruncate zero-fills, which is also every counter's initial value.
+    page = new (mem) corvus_metrics::Page;
+    corvus_metrics::Header& h = page->header;
+    h.version = corvus_metrics::kFormatVersion;
+    h.page_size = sizeof(corvus_metrics::Page);
+    h.pid = static_cast<int32_t>(getpid());
+    h.start_nanos.store(nowNanos(), std::memory_order_relaxed);
+    h.state.store(corvus_metrics::STATE_STARTING, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(h.magic, corvus_metrics::kMagic, sizeof(h.magic));
+}
+
+CorvusCModelMetricsPage::~CorvusCModelMetricsPage() {
+    markStopped();
+    munmap(page, sizeof(corvus_metrics::Page));
+    shm_unlink(name.c_str());
+}
+
+void CorvusCModelMetricsPage::configure(const std::string& model, uint32_t mBusCount, uint32_t sBusCount,
+                                        uint32_t xBusCount) {
+    // The header's counts must match the backlog rows, or readers reject the page.
+    if (static_cast<uint64_t>(mBusCount) + sBusCount + xBusCount > corvus_metrics::kMaxBuses) {
+        throw std::runtime_error("[CorvusCModelMetrics] more than corvus_metrics::kMaxBuses bus lanes");
+    }
+    corvus_metrics::Header& h = page->header;
+    copyName(h.model, model);
+    h.mbus_count = mBusCount;
+    h.sbus_count = sBusCount;
+    h.xbus_count = xBusCount;
+    buses.clear();
+}
+
+void CorvusCModelMetricsPage::addBus(CorvusCModelIdealizedBus* bus) {
+    if (buses.size() >= corvus_metrics::kMaxBuses) {
+        throw std::runtime_error("[CorvusCModelMetrics] more than corvus_metrics::kMaxBuses bus lanes");
+    }
+    buses.push_back(bus);
+}
+
+void CorvusCModelMetricsPage::attach(CorvusSimWorker& worker, const std::string& label) {
+    if (clocks.size() >= corvus_metrics::kMaxWorkers) {
+        throw std::runtime_error("[CorvusCModelMetrics] more than corvus_metrics::kMaxWorkers workers");
+    }
+    const uint32_t slot = static_cast<uint32_t>(clocks.size());
+    WorkerClock clock;
+    clock.next = worker.getPhaseObserver();
+    clock.nextSlot = worker.getPhaseSlot();
+    clocks.push_back(clock);
+    copyName(page->workers[slot].name, label);
+    std::atomic_thread_fence(std::memory_order_release);
+    page->header.worker_count = slot + 1;
+    worker.setPhaseObserver(this, slot);
+}
+
+void CorvusCModelMetricsPage::enterPhase(uint32_t slot, CorvusWorkerPhase phase) {
+    WorkerClock& clock = clocks[slot];
+    const uint64_t now = nowNanos();
+    if (clock.lastNanos != 0) {
+        corvus_metrics::WorkerRow& row = page->workers[slot];
+        add(row.phase_nanos[static_cast<uint32_t>(clock.phase)], now - clock.lastNanos);
+        if (phase == CorvusWorkerPhase::IDLE && clock.phase == CorvusWorkerPhase::S_OUTPUTS) {
+            add(row.cycles, 1);
+        }
+    }
+    clock.lastNanos = now;
+    clock.phase = phase;
+    if (clock.next) clock.next->enterPhase(clock.nextSlot, phase);
+}
+
+void CorvusCModelMetricsPage::beginEval() {
+    evalStart = nowNanos();
+    if (lastSampleNanos == 0) {
+        lastSampleNanos = evalStart;
+        lastSampleCycles = cycles;
+        page->header.state.store(corvus_metrics::STATE_RUNNING, std::memory_order_relaxed);
+    }
+}
+
+void CorvusCModelMetricsPage::endEval() {
+    const uint64_t now = nowNanos();
+    corvus_metrics::Header& h = page->header;
+    h.cycles.store(++cycles, std::memory_order_relaxed);
+    add(h.eval_nanos, now - evalStart);
+    if (now - lastSampleNanos >= kSampleNanos) sample(now);
+}
+
+void CorvusCModelMetricsPage::sample(uint64_t now) {
+    const double seconds = static_cast<double>(now - lastSampleNanos) * 1e-9;
+    const double current = static_cast<double>(cycles - lastSampleCycles) / seconds;
+    rate = rate == 0.0 ? current : 0.3 * current + 0.7 * rate;
+    lastSampleNanos = now;
+    lastSampleCycles = cycles;
+    corvus_metrics::Header& h = page->header;
+    h.cycles_per_second.store(rate, std::memory_order_relaxed);
+    for (size_t i = 0; i < buses.size(); ++i) {
+        page->bus_backlog[i].store(buses[i]->takePeakBacklog(), std::memory_order_relaxed);
+    }
+    h.update_nanos.store(now, std::memory_order_relaxed);
+}
+
+void CorvusCModelMetricsPage::markStopped() {
+    // The buses go away with the model; the page may outlive it.
+    buses.clear();
+    page->header.update_nanos.store(nowNanos(), std::memory_order_relaxed);
+    page->header.state.store(corvus_metrics::STATE_STOPPED, std::memory_order_relaxed);
+}
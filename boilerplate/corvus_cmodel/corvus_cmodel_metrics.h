@@ -0,0 +1,70 @@
+#ifndef CORVUS_CMODEL_METRICS_H
+#define CORVUS_CMODEL_METRICS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../corvus/corvus_sim_worker.h"
+#include "../../include/corvus_metrics_page.h"
+#include "corvus_cmodel_idealized_bus.h"
+
+// Publishes a running CModel's progress in a POSIX shared-memory object
+// (corvus_metrics::Page) that corvus_top attaches to: cycles done, an EWMA of
+// cycles/s, per-worker time per phase (IDLE is the barrier wait) and the peak
+// receive backlog per bus lane. Hot-path updates are relaxed stores to
+// memory only this process writes plus one steady_clock read per phase
+// boundary; the rate and the bus backlogs are sampled every
+// kSampleNanos from eval(). One page per CModel instance.
+class CorvusCModelMetricsPage : public CorvusWorkerPhaseObserver {
+public:
+    static constexpr uint64_t kSampleNanos = 100000000;  // 100 ms
+
+    // Creates the shared-memory object `name`, which must look like
+    // "/corvus-run". An existing page is only replaced when its publisher
+    // has exited; a live one (or a foreign object) of that name throws
+    // std::runtime_error, as does any other failure.
+    explicit CorvusCModelMetricsPage(const std::string& name);
+    // Marks the page stopped, unmaps and unlinks it.
+    ~CorvusCModelMetricsPage() override;
+    CorvusCModelMetricsPage(const CorvusCModelMetricsPage&) = delete;
+    CorvusCModelMetricsPage& operator=(const CorvusCModelMetricsPage&) = delete;
+
+    const std::string& getName() const { return name; }
+
+    // Called by the CModel while it builds, buses in lane order (MBus, SBus, XBus).
+    // Both throw std::runtime_error past kMaxBuses lanes in total.
+    void configure(const std::string& model, uint32_t mBusCount, uint32_t sBusCount, uint32_t xBusCount);
+    void addBus(CorvusCModelIdealizedBus* bus);
+    // Observe `worker`, keeping any observer it already has (perf counters)
+    // behind this one. Throws std::runtime_error past kMaxWorkers.
+    void attach(CorvusSimWorker& worker, const std::string& label);
+    void enterPhase(uint32_t slot, CorvusWorkerPhase phase) override;
+
+    // Around every CModel eval(), on the thread calling it.
+    void beginEval();
+    void endEval();
+    // Called by the CModel's stop(); later samples no longer touch its buses.
+    void markStopped();
+
+private:
+    struct WorkerClock {
+        uint64_t lastNanos = 0;
+        CorvusWorkerPhase phase = CorvusWorkerPhase::IDLE;
+        CorvusWorkerPhaseObserver* next = nullptr;
+        uint32_t nextSlot = 0;
+    };
+    void sample(uint64_t now);
+
+    std::string name;
+    corvus_metrics::Page* page = nullptr;
+    std::vector<WorkerClock> clocks;
+    std::vector<CorvusCModelIdealizedBus*> buses;
+    uint64_t evalStart = 0;
+    uint64_t cycles = 0;
+    uint64_t lastSampleNanos = 0;
+    uint64_t lastSampleCycles = 0;
+    double rate = 0.0;
+};
+
+#endif // CORVUS_CMODEL_METRICS_H
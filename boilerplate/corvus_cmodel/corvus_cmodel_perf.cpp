@@ -0,0 +1,195 @@
+#include "corvus_cmodel_perf.h"
+
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+std::atomic<uint64_t> nextInstanceId{1};
+
+const char* const kPhaseNames[] = {"load_inputs", "c_eval", "c_outputs", "s_eval", "s_outputs"};
+const char* const kCounterNames[] = {"cycles", "instructions", "LLC misses", "branch misses"};
+
+#ifdef __linux__
+int openCounter(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // pid 0, cpu -1: the calling thread, on whichever CPU it runs.
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+const uint64_t kCounterConfigs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+#endif
+} // namespace
+
+struct CorvusCModelPerfCounters::ThreadCounters {
+    // fds[c] < 0 when counter c could not be opened; fds[CYCLES] leads the group.
+    std::array<int, COUNTER_COUNT> fds{{-1, -1, -1, -1}};
+    // Position of each opened counter in a group read, in open order.
+    std::array<int, COUNTER_COUNT> readIndex{{-1, -1, -1, -1}};
+    uint32_t opened = 0;
+    std::array<uint64_t, COUNTER_COUNT> last{};
+    uint32_t slot = 0;
+    CorvusWorkerPhase phase = CorvusWorkerPhase::IDLE;
+
+    ~ThreadCounters() {
+#ifdef __linux__
+        for (int fd : fds) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    bool read(std::array<uint64_t, COUNTER_COUNT>& out) const {
+#ifdef __linux__
+        uint64_t buffer[1 + COUNTER_COUNT];
+        const ssize_t want = static_cast<ssize_t>(sizeof(uint64_t) * (1 + opened));
+        if (::read(fds[CYCLES], buffer, sizeof(buffer)) < want) return false;
+        for (uint32_t c = 0; c < COUNTER_COUNT; ++c) {
+            out[c] = readIndex[c] < 0 ? 0 : buffer[1 + readIndex[c]];
+        }
+        return true;
+#else
+        (void)out;
+        return false;
+#endif
+    }
+};
+
+CorvusCModelPerfCounters::CorvusCModelPerfCounters()
+    : instanceId(nextInstanceId.fetch_add(1, std::memory_order_relaxed)) {}
+
+CorvusCModelPerfCounters::~CorvusCModelPerfCounters() = default;
+
+void CorvusCModelPerfCounters::attach(CorvusSimWorker& worker, std::string label) {
+    const uint32_t slot = static_cast<uint32_t>(slots.size());
+    slots.emplace_back();
+    labels.push_back(std::move(label));
+    worker.setPhaseObserver(this, slot);
+}
+
+// Each (instance, thread) pair opens its group once, kept in `threads`. A pool
+// thread may serve several instances in turn, so the thread-local entry is
+// only a fast path for the last one; it is keyed by the instance id rather
+// than by address, which a later instance may reuse.
+CorvusCModelPerfCounters::ThreadCounters* CorvusCModelPerfCounters::threadCounters() {
+    thread_local uint64_t cachedId = 0;
+    thread_local ThreadCounters* cached = nullptr;
+    if (cachedId == instanceId) return cached;
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    std::unique_ptr<ThreadCounters>& counters = threads[std::this_thread::get_id()];
+    if (!counters) {
+        counters.reset(new ThreadCounters);
+        openCounters(*counters);
+    }
+    cachedId = instanceId;
+    cached = counters.get();
+    return cached;
+}
+
+void CorvusCModelPerfCounters::openCounters(ThreadCounters& counters) {
+#ifdef __linux__
+    for (uint32_t c = 0; c < COUNTER_COUNT; ++c) {
+        if (c != CYCLES && counters.fds[CYCLES] < 0) break;
+        const int fd = openCounter(kCounterConfigs[c], c == CYCLES ? -1 : counters.fds[CYCLES]);
+        if (fd < 0) {
+            int expected = 0;
+            openError.compare_exchange_strong(expected, errno);
+            missingMask.fetch_or(1u << c, std::memory_order_relaxed);
+            continue;
+        }
+        counters.fds[c] = fd;
+        counters.readIndex[c] = static_cast<int>(counters.opened++);
+    }
+    if (counters.fds[CYCLES] >= 0) openedThreads.fetch_add(1, std::memory_order_relaxed);
+#else
+    (void)counters;
+#endif
+}
+
+void CorvusCModelPerfCounters::enterPhase(uint32_t slot, CorvusWorkerPhase phase) {
+    ThreadCounters* counters = threadCounters();
+    if (counters->fds[CYCLES] < 0) return;
+    std::array<uint64_t, COUNTER_COUNT> now;
+    if (!counters->read(now)) return;
+    if (counters->phase != CorvusWorkerPhase::IDLE && counters->slot < slots.size()) {
+        PhaseStats& st = slots[counters->slot][static_cast<uint32_t>(counters->phase)];
+        st.runs++;
+        for (uint32_t c = 0; c < COUNTER_COUNT; ++c) {
+            st.values[c] += now[c] - counters->last[c];
+        }
+    }
+    counters->last = now;
+    counters->slot = slot;
+    counters->phase = phase;
+}
+
+const CorvusCModelPerfCounters::PhaseStats& CorvusCModelPerfCounters::stats(uint32_t slot,
+                                                                             CorvusWorkerPhase phase) const {
+    if (slot >= slots.size() || phase == CorvusWorkerPhase::IDLE) {
+        throw std::out_of_range("[CorvusCModelPerf] no statistics for this slot/phase");
+    }
+    return slots[slot][static_cast<uint32_t>(phase)];
+}
+
+void CorvusCModelPerfCounters::resetStatistics() {
+    for (auto& phases : slots) {
+        phases.fill(PhaseStats());
+    }
+}
+
+void CorvusCModelPerfCounters::printReport(std::ostream& os) const {
+    if (!available()) {
+        const int err = openError.load(std::memory_order_relaxed);
+#ifdef __linux__
+        os << "[CorvusCModelPerf] hardware counters unavailable: perf_event_open: "
+           << (err ? std::strerror(err) : "no worker phase observed")
+           << " (check /proc/sys/kernel/perf_event_paranoid)\n";
+#else
+        (void)err;
+        os << "[CorvusCModelPerf] hardware counters are only supported on Linux\n";
+#endif
+        return;
+    }
+    const std::ios::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os << "[CorvusCModelPerf] " << slots.size() << " workers, " << openedThreads.load(std::memory_order_relaxed)
+       << " counting threads, user space; per run of each phase:\n";
+    const uint32_t missing = missingCounters();
+    for (uint32_t c = 0; c < COUNTER_COUNT; ++c) {
+        if (missing & (1u << c)) os << "  (" << kCounterNames[c] << " not available on every thread)\n";
+    }
+    os << std::fixed;
+    for (size_t slot = 0; slot < slots.size(); ++slot) {
+        uint64_t total = 0;
+        for (const PhaseStats& st : slots[slot]) total += st.values[CYCLES];
+        for (uint32_t p = 0; p < kPhaseCount; ++p) {
+            const PhaseStats& st = slots[slot][p];
+            if (st.runs == 0) continue;
+            const double runs = static_cast<double>(st.runs);
+            const double cycles = static_cast<double>(st.values[CYCLES]);
+            os << "  " << labels[slot] << " " << std::left << std::setw(11) << kPhaseNames[p] << std::right
+               << std::setprecision(1) << " cycles " << cycles / runs << " ("
+               << (total ? 100.0 * cycles / static_cast<double>(total) : 0.0) << "%), IPC " << std::setprecision(2)
+               << (cycles > 0 ? static_cast<double>(st.values[INSTRUCTIONS]) / cycles : 0.0) << ", LLC misses "
+               << static_cast<double>(st.values[LLC_MISSES]) / runs << ", branch misses "
+               << static_cast<double>(st.values[BRANCH_MISSES]) / runs << "\n";
+        }
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
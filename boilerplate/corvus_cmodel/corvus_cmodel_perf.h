@@ -0,0 +1,70 @@
+#ifndef CORVUS_CMODEL_PERF_H
+#define CORVUS_CMODEL_PERF_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../corvus/corvus_sim_worker.h"
+
+// Hardware counters (cycles, instructions, LLC misses, branch misses) per
+// partition and per worker phase, so a slow partition can be told apart as
+// compute-bound in eval() or memory-bound in bus encode/decode. Each thread
+// that polls a worker opens its own perf_event_open group on first use (so it
+// works with dedicated threads and with CorvusCModelWorkerPool alike) and
+// reads it at every phase boundary; the delta goes to the phase that just
+// ended. Time in CorvusWorkerPhase::IDLE is not counted. User space only.
+// Linux only; elsewhere, or when the kernel refuses the counters
+// (perf_event_paranoid, containers), available() is false and the report
+// says why. Every boundary costs one read() syscall, so use it for
+// attribution, not for absolute throughput.
+class CorvusCModelPerfCounters : public CorvusWorkerPhaseObserver {
+public:
+    enum Counter : uint8_t { CYCLES, INSTRUCTIONS, LLC_MISSES, BRANCH_MISSES, COUNTER_COUNT };
+    static constexpr uint32_t kPhaseCount = static_cast<uint32_t>(CorvusWorkerPhase::IDLE);
+    struct PhaseStats {
+        uint64_t runs = 0;
+        std::array<uint64_t, COUNTER_COUNT> values{};
+    };
+
+    CorvusCModelPerfCounters();
+    ~CorvusCModelPerfCounters() override;
+    CorvusCModelPerfCounters(const CorvusCModelPerfCounters&) = delete;
+    CorvusCModelPerfCounters& operator=(const CorvusCModelPerfCounters&) = delete;
+
+    // Observe `worker`, reported as `label`. Call before its loop starts.
+    void attach(CorvusSimWorker& worker, std::string label);
+    void enterPhase(uint32_t slot, CorvusWorkerPhase phase) override;
+
+    // True once some thread opened at least the cycle counter.
+    bool available() const { return openedThreads.load(std::memory_order_relaxed) > 0; }
+    // Counters the kernel refused on some thread, as a bit per Counter.
+    uint32_t missingCounters() const { return missingMask.load(std::memory_order_relaxed); }
+    const PhaseStats& stats(uint32_t slot, CorvusWorkerPhase phase) const;
+    // Only while no attached worker is running.
+    void resetStatistics();
+    void printReport(std::ostream& os) const;
+
+private:
+    struct ThreadCounters;
+    ThreadCounters* threadCounters();
+    void openCounters(ThreadCounters& counters);
+
+    const uint64_t instanceId;
+    std::mutex threadsMutex;
+    std::map<std::thread::id, std::unique_ptr<ThreadCounters>> threads;
+    std::vector<std::string> labels;
+    std::vector<std::array<PhaseStats, kPhaseCount>> slots;
+    std::atomic<uint32_t> openedThreads{0};
+    std::atomic<uint32_t> missingMask{0};
+    std::atomic<int> openError{0};
+};
+
+#endif // CORVUS_CMODEL_PERF_H
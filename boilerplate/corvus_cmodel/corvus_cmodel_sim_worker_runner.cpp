@@ -13,14 +13,27 @@ CorvusCModelSimWorkerRunner::~CorvusCModelSimWorkerRunner() {
     stop();
 }
 
+void CorvusCModelSimWorkerRunner::setCoreSets(std::vector<CorvusCModelCoreSet> coreSets) {
+    this->coreSets = std::move(coreSets);
+}
+
 void CorvusCModelSimWorkerRunner::run() {
-    for (auto worker : simWorkers) {
-        threads.emplace_back([worker]() {
+    for (size_t i = 0; i < simWorkers.size(); ++i) {
+        auto worker = simWorkers[i];
+        if (worker) {
+            worker->resume();
+        }
+        const bool pin = i < coreSets.size();
+        const uint32_t core = pin ? coreSets[i].workerCore : 0;
+        threads.emplace_back([worker, pin, core]() {
 #if defined(__unix__) || defined(__APPLE__)
             // Allow cancellation even without explicit cancel points in worker loops.
             pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, nullptr);
             pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, nullptr);
 #endif
+            if (pin) {
+                corvusCModelSetThreadAffinity({core});
+            }
             if (worker) {
                 worker->loop();
             }
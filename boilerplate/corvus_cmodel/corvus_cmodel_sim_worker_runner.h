@@ -6,17 +6,21 @@
 #include <vector>
 
 #include "../corvus/corvus_sim_worker.h"
+#include "corvus_cmodel_affinity.h"
 
 class CorvusCModelSimWorkerRunner {
 public:
     explicit CorvusCModelSimWorkerRunner(std::vector<std::shared_ptr<CorvusSimWorker>> simWorkers);
     ~CorvusCModelSimWorkerRunner();
 
+    // Pin worker i's thread to coreSets[i].workerCore from the next run().
+    void setCoreSets(std::vector<CorvusCModelCoreSet> coreSets);
     void run();
     void stop();
 
 private:
     std::vector<std::shared_ptr<CorvusSimWorker>> simWorkers;
+    std::vector<CorvusCModelCoreSet> coreSets;
     std::vector<std::thread> threads;
 };
 
@@ -0,0 +1,279 @@
+#include "corvus_cmodel_stimulus.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+constexpr char kStimulusMagic[4] = {'C', 'V', 'S', 'T'};
+constexpr uint32_t kStimulusVersion = 1;
+constexpr uint32_t kStimulusFlagOutputs = 1u;
+constexpr size_t kStimulusBufferSize = 1 << 20;
+// Unchanged gaps shorter than this are folded into the surrounding run; a new
+// run costs at least two varint bytes.
+constexpr size_t kStimulusMinGap = 4;
+
+struct StimulusHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t inputBytes;
+    uint32_t outputBytes;
+    uint32_t reserved;
+    uint64_t inputFingerprint;
+    uint64_t outputFingerprint;
+    uint64_t frameCount;
+};
+} // namespace
+
+CorvusCModelPortLayout::CorvusCModelPortLayout(const CorvusPortSpan* spans, size_t count)
+    : spans(spans, spans + count) {
+    for (const auto& s : this->spans) {
+        bytes += s.size;
+    }
+}
+
+uint64_t CorvusCModelPortLayout::fingerprint() const {
+    uint64_t h = 1469598103934665603ULL;
+    auto mix = [&h](uint32_t v) {
+        for (int i = 0; i < 4; ++i) {
+            h = (h ^ ((v >> (8 * i)) & 0xFF)) * 1099511628211ULL;
+        }
+    };
+    for (const auto& s : spans) {
+        mix(s.offset);
+        mix(s.size);
+    }
+    return h;
+}
+
+void CorvusCModelPortLayout::gather(const void* ports, uint8_t* frame) const {
+    const uint8_t* base = static_cast<const uint8_t*>(ports);
+    for (const auto& s : spans) {
+        std::memcpy(frame, base + s.offset, s.size);
+        frame += s.size;
+    }
+}
+
+void CorvusCModelPortLayout::scatter(const uint8_t* frame, void* ports) const {
+    uint8_t* base = static_cast<uint8_t*>(ports);
+    for (const auto& s : spans) {
+        std::memcpy(base + s.offset, frame, s.size);
+        frame += s.size;
+    }
+}
+
+CorvusCModelStimulusRecorder::CorvusCModelStimulusRecorder(const CorvusCModelPortLayout& inputs,
+                                                           const CorvusCModelPortLayout& outputs)
+    : inputs(inputs), outputs(outputs) {}
+
+CorvusCModelStimulusRecorder::~CorvusCModelStimulusRecorder() {
+    close();
+}
+
+void CorvusCModelStimulusRecorder::open(const std::string& path, bool withOutputs) {
+    close();
+    outBuffer.resize(kStimulusBufferSize);
+    out.rdbuf()->pubsetbuf(outBuffer.data(), static_cast<std::streamsize>(outBuffer.size()));
+    out.open(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        throw std::runtime_error("Failed to open stimulus recording for write: " + path);
+    }
+    this->withOutputs = withOutputs;
+    frameCount = 0;
+    prevIn.assign(inputs.frameBytes(), 0);
+    curIn.assign(inputs.frameBytes(), 0);
+    prevOut.assign(withOutputs ? outputs.frameBytes() : 0, 0);
+    curOut.assign(prevOut.size(), 0);
+
+    StimulusHeader header{};
+    std::memcpy(header.magic, kStimulusMagic, sizeof(kStimulusMagic));
+    header.version = kStimulusVersion;
+    header.flags = withOutputs ? kStimulusFlagOutputs : 0;
+    header.inputBytes = static_cast<uint32_t>(inputs.frameBytes());
+    header.outputBytes = static_cast<uint32_t>(outputs.frameBytes());
+    header.inputFingerprint = inputs.fingerprint();
+    header.outputFingerprint = outputs.fingerprint();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+void CorvusCModelStimulusRecorder::close() {
+    if (!out.is_open()) return;
+    // The frame count is only known at the end; patch it into the header.
+    out.seekp(offsetof(StimulusHeader, frameCount));
+    out.write(reinterpret_cast<const char*>(&frameCount), sizeof(frameCount));
+    out.close();
+}
+
+void CorvusCModelStimulusRecorder::recordInputs(const void* ports) {
+    if (!out.is_open()) return;
+    inputs.gather(ports, curIn.data());
+    writeDelta(prevIn, curIn);
+    ++frameCount;
+}
+
+void CorvusCModelStimulusRecorder::recordOutputs(const void* ports) {
+    if (!out.is_open() || !withOutputs) return;
+    outputs.gather(ports, curOut.data());
+    writeDelta(prevOut, curOut);
+}
+
+void CorvusCModelStimulusRecorder::writeDelta(std::vector<uint8_t>& prev, const std::vector<uint8_t>& cur) {
+    // Runs as [begin, end) byte ranges of `cur` that differ from `prev`.
+    std::vector<std::pair<size_t, size_t>> runs;
+    size_t i = 0;
+    const size_t n = cur.size();
+    while (i < n) {
+        if (cur[i] == prev[i]) {
+            ++i;
+            continue;
+        }
+        size_t begin = i;
+        size_t end = i + 1;
+        size_t j = end;
+        while (j < n) {
+            if (cur[j] != prev[j]) {
+                end = ++j;
+            } else if (j - end >= kStimulusMinGap) {
+                break;
+            } else {
+                ++j;
+            }
+        }
+        runs.emplace_back(begin, end);
+        i = end;
+    }
+    writeVarint(runs.size());
+    size_t last = 0;
+    for (const auto& run : runs) {
+        writeVarint(run.first - last);
+        writeVarint(run.second - run.first);
+        out.write(reinterpret_cast<const char*>(cur.data() + run.first),
+                  static_cast<std::streamsize>(run.second - run.first));
+        std::memcpy(prev.data() + run.first, cur.data() + run.first, run.second - run.first);
+        last = run.second;
+    }
+}
+
+void CorvusCModelStimulusRecorder::writeVarint(uint64_t v) {
+    while (v >= 0x80) {
+        out.put(static_cast<char>((v & 0x7F) | 0x80));
+        v >>= 7;
+    }
+    out.put(static_cast<char>(v));
+}
+
+CorvusCModelStimulusReplay::CorvusCModelStimulusReplay(const CorvusCModelPortLayout& inputs,
+                                                       const CorvusCModelPortLayout& outputs)
+    : inputs(inputs), outputs(outputs) {}
+
+CorvusCModelStimulusReplay::~CorvusCModelStimulusReplay() {
+    close();
+}
+
+void CorvusCModelStimulusReplay::open(const std::string& path) {
+    close();
+    this->path = path;
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open stimulus recording: " + path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(StimulusHeader)) {
+        ::close(fd);
+        throw std::runtime_error("Invalid stimulus recording " + path + ": truncated header");
+    }
+    size = static_cast<size_t>(st.st_size);
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        size = 0;
+        throw std::runtime_error("Failed to map stimulus recording: " + path);
+    }
+    data = static_cast<const uint8_t*>(addr);
+    madvise(addr, size, MADV_SEQUENTIAL);
+
+    StimulusHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    const char* why = nullptr;
+    if (std::memcmp(header.magic, kStimulusMagic, sizeof(kStimulusMagic)) != 0) {
+        why = "bad magic";
+    } else if (header.version != kStimulusVersion) {
+        why = "unsupported version";
+    } else if (header.inputBytes != inputs.frameBytes() ||
+               header.inputFingerprint != inputs.fingerprint()) {
+        why = "recorded for a different TopPortsGen input layout";
+    } else if ((header.flags & kStimulusFlagOutputs) &&
+               (header.outputBytes != outputs.frameBytes() ||
+                header.outputFingerprint != outputs.fingerprint())) {
+        why = "recorded for a different TopPortsGen output layout";
+    }
+    if (why) {
+        close();
+        throw std::runtime_error("Invalid stimulus recording " + path + ": " + why);
+    }
+    withOutputs = (header.flags & kStimulusFlagOutputs) != 0;
+    frameCount = header.frameCount;
+    frameIndex = 0;
+    pos = sizeof(StimulusHeader);
+    inFrame.assign(inputs.frameBytes(), 0);
+    outFrame.assign(withOutputs ? outputs.frameBytes() : 0, 0);
+    actualOut.assign(outFrame.size(), 0);
+}
+
+void CorvusCModelStimulusReplay::close() {
+    if (data) {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+    data = nullptr;
+    size = 0;
+    pos = 0;
+}
+
+bool CorvusCModelStimulusReplay::next(void* ports) {
+    if (!data || frameIndex >= frameCount) return false;
+    applyDelta(inFrame);
+    if (withOutputs) applyDelta(outFrame);
+    inputs.scatter(inFrame.data(), ports);
+    ++frameIndex;
+    return true;
+}
+
+bool CorvusCModelStimulusReplay::outputsMatch(const void* ports) {
+    if (!withOutputs) return true;
+    outputs.gather(ports, actualOut.data());
+    return actualOut == outFrame;
+}
+
+void CorvusCModelStimulusReplay::applyDelta(std::vector<uint8_t>& frame) {
+    uint64_t runs = readVarint();
+    size_t at = 0;
+    for (uint64_t r = 0; r < runs; ++r) {
+        at += readVarint();
+        uint64_t len = readVarint();
+        if (at + len > frame.size() || pos + len > size) {
+            throw std::runtime_error("Invalid stimulus recording " + path + ": corrupt frame " +
+                                     std::to_string(frameIndex));
+        }
+        std::memcpy(frame.data() + at, data + pos, len);
+        pos += len;
+        at += len;
+    }
+}
+
+uint64_t CorvusCModelStimulusReplay::readVarint() {
+    uint64_t v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos >= size) break;
+        uint8_t b = data[pos++];
+        v |= static_cast<uint64_t>(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) return v;
+    }
+    throw std::runtime_error("Invalid stimulus recording " + path + ": truncated frame " +
+                             std::to_string(frameIndex));
+}
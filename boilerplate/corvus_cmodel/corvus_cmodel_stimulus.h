@@ -0,0 +1,102 @@
+#ifndef CORVUS_CMODEL_STIMULUS_H
+#define CORVUS_CMODEL_STIMULUS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// One TopPortsGen member: byte offset inside the struct and its size.
+struct CorvusPortSpan {
+    uint32_t offset;
+    uint32_t size;
+};
+
+// Packs the listed TopPortsGen members into a contiguous frame (no padding).
+class CorvusCModelPortLayout {
+public:
+    CorvusCModelPortLayout(const CorvusPortSpan* spans, size_t count);
+
+    size_t frameBytes() const { return bytes; }
+    // FNV-1a over the span table; a recording only replays on the same layout.
+    uint64_t fingerprint() const;
+    void gather(const void* ports, uint8_t* frame) const;
+    void scatter(const uint8_t* frame, void* ports) const;
+
+private:
+    std::vector<CorvusPortSpan> spans;
+    size_t bytes = 0;
+};
+
+// File layout ("CVST"): a fixed header, then one record per eval(). A record
+// is the input frame delta, followed by the output frame delta when the
+// recording was made with outputs. A delta is varint(runCount) then, per run,
+// varint(skip) varint(length) and `length` raw bytes, relative to the
+// previous frame (all-zero before the first record).
+class CorvusCModelStimulusRecorder {
+public:
+    CorvusCModelStimulusRecorder(const CorvusCModelPortLayout& inputs,
+                                 const CorvusCModelPortLayout& outputs);
+    ~CorvusCModelStimulusRecorder();
+
+    // Throws std::runtime_error when the file cannot be created.
+    void open(const std::string& path, bool withOutputs);
+    void close();
+    bool isOpen() const { return out.is_open(); }
+    uint64_t frames() const { return frameCount; }
+
+    // Call around every eval(): inputs before, outputs after.
+    void recordInputs(const void* ports);
+    void recordOutputs(const void* ports);
+
+private:
+    void writeDelta(std::vector<uint8_t>& prev, const std::vector<uint8_t>& cur);
+    void writeVarint(uint64_t v);
+
+    const CorvusCModelPortLayout& inputs;
+    const CorvusCModelPortLayout& outputs;
+    std::ofstream out;
+    std::vector<char> outBuffer;
+    bool withOutputs = false;
+    uint64_t frameCount = 0;
+    std::vector<uint8_t> prevIn, curIn, prevOut, curOut;
+};
+
+// Reads a recording through mmap and applies it frame by frame.
+class CorvusCModelStimulusReplay {
+public:
+    CorvusCModelStimulusReplay(const CorvusCModelPortLayout& inputs,
+                               const CorvusCModelPortLayout& outputs);
+    ~CorvusCModelStimulusReplay();
+    CorvusCModelStimulusReplay(const CorvusCModelStimulusReplay&) = delete;
+    CorvusCModelStimulusReplay& operator=(const CorvusCModelStimulusReplay&) = delete;
+
+    // Throws std::runtime_error on a missing, truncated or foreign recording.
+    void open(const std::string& path);
+    void close();
+
+    bool hasOutputs() const { return withOutputs; }
+    uint64_t frames() const { return frameCount; }
+    // Writes the next frame's inputs into `ports`; false once all frames ran.
+    bool next(void* ports);
+    // Compares `ports` outputs against the frame last returned by next().
+    bool outputsMatch(const void* ports);
+
+private:
+    void applyDelta(std::vector<uint8_t>& frame);
+    uint64_t readVarint();
+
+    const CorvusCModelPortLayout& inputs;
+    const CorvusCModelPortLayout& outputs;
+    std::string path;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    size_t pos = 0;
+    bool withOutputs = false;
+    uint64_t frameCount = 0;
+    uint64_t frameIndex = 0;
+    std::vector<uint8_t> inFrame, outFrame, actualOut;
+};
+
+#endif // CORVUS_CMODEL_STIMULUS_H
@@ -18,12 +18,14 @@ CorvusSynctreeEndpoint::ValueFlag aggregateFlag(const std::vector<std::atomic<ui
 }
 } // namespace
 
-CorvusCModelSyncTree::CorvusCModelSyncTree(uint32_t nSimWorker)
+CorvusCModelSyncTree::CorvusCModelSyncTree(uint32_t nSimWorker, uint32_t endpointCount)
         : simWorkerStartFlag(0),
           topSyncFlag(0),
           topAllowSOutputFlag(0),
           simWorkerInputReadyFlag(nSimWorker),
           simWorkerSyncFlag(nSimWorker),
+          topEpoch(0),
+          workerEpochs(endpointCount > 0 ? endpointCount : nSimWorker + 1),
           topEndpoint(nullptr) {
     simWorkerStartFlag.store(0, std::memory_order_relaxed);
     topSyncFlag.store(0, std::memory_order_relaxed);
@@ -34,6 +36,9 @@ CorvusCModelSyncTree::CorvusCModelSyncTree(uint32_t nSimWorker)
     for (auto& f : simWorkerSyncFlag) {
         f.store(0, std::memory_order_relaxed);
     }
+    for (auto& e : workerEpochs) {
+        e.store(0, std::memory_order_relaxed);
+    }
     topEndpoint = std::make_shared<CorvusCModelTopSynctreeEndpoint>(this);
     simWorkerEndpoints.reserve(nSimWorker);
     for (uint32_t i = 0; i < nSimWorker; ++i) {
@@ -137,3 +142,32 @@ CorvusSynctreeEndpoint::ValueFlag CorvusCModelSimWorkerSynctreeEndpoint::getSimW
 CorvusSynctreeEndpoint::ValueFlag CorvusCModelSimWorkerSynctreeEndpoint::getTopAllowSOutputFlag() {
     return CorvusCModelSyncTree::loadFlag(tree->topAllowSOutputFlag);
 }
+
+void CorvusCModelTopSynctreeEndpoint::setTopEpoch(uint64_t epoch) {
+    tree->topEpoch.store(epoch, std::memory_order_release);
+}
+
+uint64_t CorvusCModelTopSynctreeEndpoint::getWorkerEpoch(uint32_t endpointId) {
+    if (endpointId >= tree->workerEpochs.size()) {
+        throw std::out_of_range("Invalid endpoint id for worker epoch");
+    }
+    return tree->workerEpochs[endpointId].load(std::memory_order_acquire);
+}
+
+uint64_t CorvusCModelSimWorkerSynctreeEndpoint::getTopEpoch() {
+    return tree->topEpoch.load(std::memory_order_acquire);
+}
+
+uint64_t CorvusCModelSimWorkerSynctreeEndpoint::getWorkerEpoch(uint32_t endpointId) {
+    if (endpointId >= tree->workerEpochs.size()) {
+        throw std::out_of_range("Invalid endpoint id for worker epoch");
+    }
+    return tree->workerEpochs[endpointId].load(std::memory_order_acquire);
+}
+
+void CorvusCModelSimWorkerSynctreeEndpoint::setWorkerEpoch(uint32_t endpointId, uint64_t epoch) {
+    if (endpointId >= tree->workerEpochs.size()) {
+        throw std::out_of_range("Invalid endpoint id for worker epoch");
+    }
+    tree->workerEpochs[endpointId].store(epoch, std::memory_order_release);
+}
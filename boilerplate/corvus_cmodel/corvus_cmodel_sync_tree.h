@@ -13,10 +13,11 @@
 class CorvusCModelTopSynctreeEndpoint;
 class CorvusCModelSimWorkerSynctreeEndpoint;
 
-// Coordinates sync flags between TopModule and SimWorkers.
+// Coordinates sync flags between TopModule and SimWorkers. Dataflow epochs are
+// kept per bus endpoint id; `endpointCount` defaults to nSimWorker + 1.
 class CorvusCModelSyncTree {
 public:
-    explicit CorvusCModelSyncTree(uint32_t nSimWorker);
+    explicit CorvusCModelSyncTree(uint32_t nSimWorker, uint32_t endpointCount = 0);
     ~CorvusCModelSyncTree();
     CorvusCModelSyncTree(const CorvusCModelSyncTree&) = delete;
     CorvusCModelSyncTree& operator=(const CorvusCModelSyncTree&) = delete;
@@ -36,6 +37,8 @@ private:
     std::atomic<uint8_t> topAllowSOutputFlag;
     std::vector<std::atomic<uint8_t>> simWorkerInputReadyFlag;
     std::vector<std::atomic<uint8_t>> simWorkerSyncFlag;
+    std::atomic<uint64_t> topEpoch;
+    std::vector<std::atomic<uint64_t>> workerEpochs;
     std::shared_ptr<CorvusCModelTopSynctreeEndpoint> topEndpoint;
     std::vector<std::shared_ptr<CorvusCModelSimWorkerSynctreeEndpoint>> simWorkerEndpoints;
 };
@@ -53,6 +56,9 @@ public:
     void setTopAllowSOutputFlag(ValueFlag flag) override;
     void setTopSyncFlag(ValueFlag flag) override;
     void setSimWorkerStartFlag(ValueFlag flag) override;
+    bool hasEpochs() const override { return true; }
+    void setTopEpoch(uint64_t epoch) override;
+    uint64_t getWorkerEpoch(uint32_t endpointId) override;
 private:
     CorvusCModelSyncTree* tree;
 };
@@ -67,6 +73,10 @@ public:
     ValueFlag getTopSyncFlag() override;
     ValueFlag getSimWorkerStartFlag() override;
     ValueFlag getTopAllowSOutputFlag() override;
+    bool hasEpochs() const override { return true; }
+    uint64_t getTopEpoch() override;
+    uint64_t getWorkerEpoch(uint32_t endpointId) override;
+    void setWorkerEpoch(uint32_t endpointId, uint64_t epoch) override;
 
 private:
     CorvusCModelSyncTree* tree;
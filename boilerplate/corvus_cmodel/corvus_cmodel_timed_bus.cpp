@@ -0,0 +1,183 @@
+#include "corvus_cmodel_timed_bus.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+
+CorvusCModelTimingModel::CorvusCModelTimingModel(const CorvusCModelTimingParams& params)
+    : params(params) {
+    if (params.mBus.bandwidth <= 0.0 || params.sBus.bandwidth <= 0.0 || params.xBus.bandwidth <= 0.0) {
+        throw std::invalid_argument("[CorvusCModelTiming] lane bandwidth must be positive");
+    }
+}
+
+void CorvusCModelTimingModel::configure(uint32_t mBusCount, uint32_t sBusCount, uint32_t endpointCount,
+                                        uint32_t syncCrossings, uint32_t xBusCount) {
+    this->mBusCount = mBusCount;
+    this->syncCrossings = syncCrossings;
+    this->sBusCount = sBusCount;
+    this->xBusCount = xBusCount;
+    this->endpointCount = endpointCount;
+    senderFrames.assign(2 * static_cast<size_t>(endpointCount), std::vector<uint32_t>());
+    downSenders.assign(1, MBUS * endpointCount + 0);
+    upSenders.clear();
+    for (uint32_t src = 1; src < endpointCount; ++src) {
+        upSenders.push_back(MBUS * endpointCount + src);
+    }
+    for (uint32_t src = 0; src < endpointCount; ++src) {
+        upSenders.push_back(SBUS * endpointCount + src);
+    }
+    resetStatistics();
+}
+
+void CorvusCModelTimingModel::record(BusKind kind, uint32_t lane, uint32_t sourceId) {
+    switch (kind) {
+    case MBUS: senderFrames[sourceId].push_back(lane); break;
+    case SBUS: senderFrames[endpointCount + sourceId].push_back(mBusCount + lane); break;
+    case XBUS: senderFrames[endpointCount + sourceId].push_back(mBusCount + sBusCount + lane); break;
+    }
+}
+
+uint64_t CorvusCModelTimingModel::endCycle() {
+    const uint64_t down = simulatePhase(downSenders);
+    const uint64_t up = simulatePhase(upSenders);
+    for (auto& frames : senderFrames) {
+        frames.clear();
+    }
+    const uint64_t hw = down + up + static_cast<uint64_t>(syncCrossings) * params.syncLatency;
+    minCycles = cycleCount == 0 ? hw : std::min(minCycles, hw);
+    maxCycles = std::max(maxCycles, hw);
+    ++cycleCount;
+    totalCycles += hw;
+    downPhaseCycles += down;
+    upPhaseCycles += up;
+    return hw;
+}
+
+uint64_t CorvusCModelTimingModel::simulatePhase(const std::vector<uint32_t>& senderIds) {
+    uint64_t pending = 0;
+    for (uint32_t id : senderIds) {
+        pending += senderFrames[id].size();
+    }
+    if (pending == 0) return 0;
+
+    const uint32_t lanes = laneCount();
+    const size_t senders = senderIds.size();
+    queued.assign(senders * lanes, 0);
+    nextFrame.assign(senders, 0);
+    std::vector<uint32_t> laneQueued(lanes, 0);
+    std::vector<uint32_t> laneNext(lanes, 0);
+    std::vector<double> laneCredit(lanes, 0.0);
+
+    uint64_t lastArrival = 0;
+    for (uint64_t t = 0; pending > 0; ++t) {
+        // Each sender offers its next frame to the lane it was routed to.
+        for (size_t s = 0; s < senders; ++s) {
+            const auto& frames = senderFrames[senderIds[s]];
+            if (nextFrame[s] >= frames.size()) continue;
+            const uint32_t lane = frames[nextFrame[s]];
+            uint32_t& q = queued[s * lanes + lane];
+            if (q >= std::max<uint32_t>(1, laneTiming(lane).queueDepth)) {
+                ++stallCycles;
+                continue;
+            }
+            ++q;
+            ++nextFrame[s];
+            ++laneQueued[lane];
+            laneStats[lane].maxQueued = std::max(laneStats[lane].maxQueued, q);
+        }
+        // Each lane grants up to its bandwidth among the non-empty queues.
+        for (uint32_t lane = 0; lane < lanes; ++lane) {
+            if (laneQueued[lane] == 0) {
+                laneCredit[lane] = 0.0;
+                continue;
+            }
+            const CorvusCModelLaneTiming& timing = laneTiming(lane);
+            laneCredit[lane] += timing.bandwidth;
+            uint64_t granted = 0;
+            while (laneCredit[lane] >= 1.0 && laneQueued[lane] > 0) {
+                const size_t start =
+                    timing.arbitration == CorvusCModelLaneTiming::Arbitration::ROUND_ROBIN ? laneNext[lane] : 0;
+                size_t s = start;
+                for (size_t k = 0; k < senders; ++k) {
+                    s = (start + k) % senders;
+                    if (queued[s * lanes + lane] > 0) break;
+                }
+                --queued[s * lanes + lane];
+                --laneQueued[lane];
+                laneNext[lane] = static_cast<uint32_t>((s + 1) % senders);
+                laneCredit[lane] -= 1.0;
+                --pending;
+                ++granted;
+                lastArrival = std::max(lastArrival, t + timing.latency);
+            }
+            if (granted > 0) {
+                laneStats[lane].frames += granted;
+                ++laneStats[lane].busyCycles;
+            }
+        }
+    }
+    return lastArrival + 1;
+}
+
+void CorvusCModelTimingModel::resetStatistics() {
+    laneStats.assign(laneCount(), LaneStats());
+    cycleCount = 0;
+    totalCycles = 0;
+    minCycles = 0;
+    maxCycles = 0;
+    downPhaseCycles = 0;
+    upPhaseCycles = 0;
+    stallCycles = 0;
+}
+
+double CorvusCModelTimingModel::meanHardwareCycles() const {
+    return cycleCount == 0 ? 0.0 : static_cast<double>(totalCycles) / static_cast<double>(cycleCount);
+}
+
+void CorvusCModelTimingModel::printReport(std::ostream& os) const {
+    const std::ios::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os << "[CorvusCModelTiming] " << cycleCount << " simulated cycles, " << mBusCount << " MBus / "
+       << sBusCount << " SBus";
+    if (xBusCount > 0) os << " / " << xBusCount << " XBus";
+    os << " lanes\n";
+    if (cycleCount > 0) {
+        const double n = static_cast<double>(cycleCount);
+        os << std::fixed << std::setprecision(1);
+        os << "  est. hardware cycles per simulated cycle: mean " << meanHardwareCycles() << " (min "
+           << minCycles << ", max " << maxCycles << ")\n";
+        os << "  mean phase cycles: top->worker MBus " << downPhaseCycles / n << ", worker MBus+SBus "
+           << upPhaseCycles / n << ", sync " << static_cast<uint64_t>(syncCrossings) * params.syncLatency << "\n";
+        os << "  sender stall cycles (send queue full): " << stallCycles << "\n";
+        for (uint32_t lane = 0; lane < laneCount(); ++lane) {
+            const LaneStats& st = laneStats[lane];
+            if (lane < mBusCount) {
+                os << "  MBus[" << lane << "]: ";
+            } else if (lane < mBusCount + sBusCount) {
+                os << "  SBus[" << lane - mBusCount << "]: ";
+            } else {
+                os << "  XBus[" << lane - mBusCount - sBusCount << "]: ";
+            }
+            os << st.frames / n << " frames/cycle, busy "
+               << (totalCycles ? 100.0 * static_cast<double>(st.busyCycles) / static_cast<double>(totalCycles) : 0.0)
+               << "%, max queue " << st.maxQueued << "\n";
+        }
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
+CorvusCModelTimedBus::CorvusCModelTimedBus(uint32_t endpointCount, CorvusCModelTimingModel* timing,
+                                           CorvusCModelTimingModel::BusKind kind, uint32_t lane)
+    : CorvusCModelIdealizedBus(endpointCount), timing(timing), kind(kind), lane(lane) {}
+
+void CorvusCModelTimedBus::route(uint32_t sourceId, uint32_t targetId, uint64_t payload) {
+    timing->record(kind, lane, sourceId);
+    deliver(targetId, payload);
+}
+
+void CorvusCModelTimedBus::routeMulticast(uint32_t sourceId, uint64_t targetMask, uint64_t payload) {
+    timing->record(kind, lane, sourceId);
+    CorvusCModelIdealizedBus::routeMulticast(sourceId, targetMask, payload);
+}
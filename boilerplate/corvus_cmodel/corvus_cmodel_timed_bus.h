@@ -0,0 +1,121 @@
+#ifndef CORVUS_CMODEL_TIMED_BUS_H
+#define CORVUS_CMODEL_TIMED_BUS_H
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "corvus_cmodel_idealized_bus.h"
+
+// Hardware parameters of one bus lane (one MBus, SBus or XBus instance).
+struct CorvusCModelLaneTiming {
+    enum class Arbitration : uint8_t { ROUND_ROBIN, FIXED_PRIORITY };
+    double bandwidth = 1.0;    // frames granted per hardware cycle, may be fractional
+    uint32_t latency = 4;      // hardware cycles from grant to arrival
+    uint32_t queueDepth = 16;  // per-sender send queue on the lane
+    Arbitration arbitration = Arbitration::ROUND_ROBIN;
+};
+
+struct CorvusCModelTimingParams {
+    CorvusCModelLaneTiming mBus;
+    CorvusCModelLaneTiming sBus;
+    // Inter-group lanes of a two-level SBus (--partition-groups): slower and
+    // farther than a group's own SBus.
+    CorvusCModelLaneTiming xBus{0.5, 16, 16, CorvusCModelLaneTiming::Arbitration::ROUND_ROBIN};
+    // Hardware cycles for one sync-tree flag to reach the other side; a
+    // simulated cycle crosses the tree four times under
+    // CorvusSyncMode::BARRIER (top sync, input ready, allow S output, worker
+    // sync) and twice otherwise (top sync or epoch, worker sync or epoch).
+    uint32_t syncLatency = 8;
+};
+
+// Virtual-clock estimate of how long the corvus interconnect would take per
+// simulated cycle. Timed buses report every frame (lane, sender); endCycle()
+// replays the cycle's traffic in two phases separated by sync barriers:
+//   1. top -> workers on MBus (I/Eo),
+//   2. workers -> top on MBus (O/Ei) together with worker -> worker on SBus.
+// Each hardware cycle every sender pushes its next frame into the send queue
+// of the lane it was routed to (stalling while that queue is full, which also
+// blocks its later frames), then every lane grants up to `bandwidth` queued
+// frames by arbitration; a granted frame arrives `latency` cycles later.
+class CorvusCModelTimingModel {
+public:
+    enum BusKind : uint8_t { MBUS, SBUS, XBUS };
+
+    explicit CorvusCModelTimingModel(const CorvusCModelTimingParams& params = CorvusCModelTimingParams());
+
+    // Called by the CModel when it builds its buses; clears the statistics.
+    // `syncCrossings` is the number of sync-tree crossings per simulated cycle;
+    // `xBusCount` inter-group lanes follow the SBus lanes (of every group).
+    void configure(uint32_t mBusCount, uint32_t sBusCount, uint32_t endpointCount,
+                   uint32_t syncCrossings = 4, uint32_t xBusCount = 0);
+    // One frame sent by `sourceId` on lane `lane`. A source must only be driven
+    // by one thread at a time (true for CModel bus endpoints).
+    void record(BusKind kind, uint32_t lane, uint32_t sourceId);
+    // Replay the frames recorded since the previous call; returns the
+    // estimated hardware cycles of that simulated cycle.
+    uint64_t endCycle();
+    void resetStatistics();
+
+    const CorvusCModelTimingParams& getParams() const { return params; }
+    uint64_t cycles() const { return cycleCount; }
+    double meanHardwareCycles() const;
+    uint64_t maxHardwareCycles() const { return maxCycles; }
+    void printReport(std::ostream& os) const;
+
+private:
+    struct LaneStats {
+        uint64_t frames = 0;
+        uint64_t busyCycles = 0;
+        uint32_t maxQueued = 0;
+    };
+    uint32_t laneCount() const { return mBusCount + sBusCount + xBusCount; }
+    const CorvusCModelLaneTiming& laneTiming(uint32_t lane) const {
+        return lane < mBusCount ? params.mBus : lane < mBusCount + sBusCount ? params.sBus : params.xBus;
+    }
+    uint64_t simulatePhase(const std::vector<uint32_t>& senderIds);
+
+    CorvusCModelTimingParams params;
+    uint32_t mBusCount = 0;
+    uint32_t sBusCount = 0;
+    uint32_t xBusCount = 0;
+    uint32_t endpointCount = 0;
+    uint32_t syncCrossings = 4;
+    // Lane sequence per sender, indexed kind * endpointCount + source (XBus
+    // frames join their worker's SBus sequence); MBus lanes come first, SBus
+    // lanes follow at mBusCount and XBus lanes at mBusCount + sBusCount.
+    std::vector<std::vector<uint32_t>> senderFrames;
+    std::vector<uint32_t> downSenders;
+    std::vector<uint32_t> upSenders;
+    // Scratch state of simulatePhase, kept to avoid per-cycle allocation.
+    std::vector<uint32_t> queued;
+    std::vector<uint32_t> nextFrame;
+
+    std::vector<LaneStats> laneStats;
+    uint64_t cycleCount = 0;
+    uint64_t totalCycles = 0;
+    uint64_t minCycles = 0;
+    uint64_t maxCycles = 0;
+    uint64_t downPhaseCycles = 0;
+    uint64_t upPhaseCycles = 0;
+    uint64_t stallCycles = 0;
+};
+
+// Idealized bus that additionally reports each frame to a timing model.
+// Delivery stays immediate, so simulation results are unchanged.
+class CorvusCModelTimedBus : public CorvusCModelIdealizedBus {
+public:
+    CorvusCModelTimedBus(uint32_t endpointCount, CorvusCModelTimingModel* timing,
+                         CorvusCModelTimingModel::BusKind kind, uint32_t lane);
+
+    void route(uint32_t sourceId, uint32_t targetId, uint64_t payload) override;
+    // A multicast frame occupies the lane once.
+    void routeMulticast(uint32_t sourceId, uint64_t targetMask, uint64_t payload) override;
+
+private:
+    CorvusCModelTimingModel* timing;
+    CorvusCModelTimingModel::BusKind kind;
+    uint32_t lane;
+};
+
+#endif // CORVUS_CMODEL_TIMED_BUS_H
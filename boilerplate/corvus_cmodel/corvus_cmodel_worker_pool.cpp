@@ -0,0 +1,90 @@
+#include "corvus_cmodel_worker_pool.h"
+
+#include <algorithm>
+
+CorvusCModelWorkerPool::CorvusCModelWorkerPool(uint32_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([this, i]() { threadMain(i); });
+    }
+}
+
+CorvusCModelWorkerPool::~CorvusCModelWorkerPool() {
+    running.store(false);
+    for (auto& t : threads) {
+        if (t.joinable()) {
+            t.join();
+        }
+    }
+}
+
+void CorvusCModelWorkerPool::attach(const std::vector<std::shared_ptr<CorvusSimWorker>>& workers) {
+    std::lock_guard<std::mutex> lock(entriesMutex);
+    for (const auto& worker : workers) {
+        if (!worker) continue;
+        auto entry = std::make_shared<Entry>();
+        entry->worker = worker;
+        entries.push_back(std::move(entry));
+    }
+    entriesVersion.fetch_add(1);
+}
+
+void CorvusCModelWorkerPool::detach(const std::vector<std::shared_ptr<CorvusSimWorker>>& workers) {
+    std::vector<std::shared_ptr<Entry>> removed;
+    {
+        std::lock_guard<std::mutex> lock(entriesMutex);
+        auto keep = entries.begin();
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (std::find(workers.begin(), workers.end(), (*it)->worker) != workers.end()) {
+                removed.push_back(*it);
+            } else {
+                *keep++ = *it;
+            }
+        }
+        entries.erase(keep, entries.end());
+        entriesVersion.fetch_add(1);
+    }
+    // Threads may still hold the entry in their snapshot: flag it, then wait
+    // for any poll() already in progress (seq_cst pairs with threadMain).
+    // Stale snapshots keep the entry alive, not the worker: it must not be
+    // destroyed on a pool thread after its sync tree and buses are gone.
+    for (auto& entry : removed) {
+        entry->detached.store(true);
+        while (entry->busy.load()) {
+            std::this_thread::yield();
+        }
+        entry->worker.reset();
+    }
+}
+
+void CorvusCModelWorkerPool::threadMain(uint32_t index) {
+    std::vector<std::shared_ptr<Entry>> snapshot;
+    uint64_t seenVersion = ~0ULL;
+    while (running.load(std::memory_order_relaxed)) {
+        uint64_t version = entriesVersion.load();
+        if (version != seenVersion) {
+            std::lock_guard<std::mutex> lock(entriesMutex);
+            snapshot = entries;
+            seenVersion = version;
+        }
+        bool progress = false;
+        const size_t n = snapshot.size();
+        // Start each thread at a different entry to spread the first claims.
+        for (size_t k = 0; k < n; ++k) {
+            Entry& entry = *snapshot[(k + index) % n];
+            if (entry.detached.load()) continue;
+            bool expected = false;
+            if (!entry.busy.compare_exchange_strong(expected, true)) continue;
+            if (!entry.detached.load()) {
+                progress |= entry.worker->poll();
+            }
+            entry.busy.store(false);
+        }
+        if (!progress) {
+            std::this_thread::yield();
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef CORVUS_CMODEL_WORKER_POOL_H
+#define CORVUS_CMODEL_WORKER_POOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../corvus/corvus_sim_worker.h"
+
+// Bounded set of threads that drive the SimWorkers of any number of CModel
+// instances through CorvusSimWorker::poll(), instead of one spinning thread
+// per partition per instance. Each worker is polled by at most one pool
+// thread at a time.
+class CorvusCModelWorkerPool {
+public:
+    // threadCount == 0 -> std::thread::hardware_concurrency().
+    explicit CorvusCModelWorkerPool(uint32_t threadCount = 0);
+    ~CorvusCModelWorkerPool();
+    CorvusCModelWorkerPool(const CorvusCModelWorkerPool&) = delete;
+    CorvusCModelWorkerPool& operator=(const CorvusCModelWorkerPool&) = delete;
+
+    uint32_t getThreadCount() const { return static_cast<uint32_t>(threads.size()); }
+    void attach(const std::vector<std::shared_ptr<CorvusSimWorker>>& workers);
+    // Returns once no pool thread is inside poll() of any of `workers` and
+    // the pool holds no reference to them.
+    void detach(const std::vector<std::shared_ptr<CorvusSimWorker>>& workers);
+
+private:
+    struct Entry {
+        std::shared_ptr<CorvusSimWorker> worker;
+        std::atomic<bool> busy{false};
+        std::atomic<bool> detached{false};
+    };
+    void threadMain(uint32_t index);
+
+    std::mutex entriesMutex;
+    std::vector<std::shared_ptr<Entry>> entries;
+    std::atomic<uint64_t> entriesVersion{0};
+    std::atomic<bool> running{true};
+    std::vector<std::thread> threads;
+};
+
+#endif // CORVUS_CMODEL_WORKER_POOL_H
@@ -0,0 +1,9 @@
+#ifndef CORVUS_GEN_BUILD_CORVUS_SLOT_BATCH_TEST_AGG_H
+#define CORVUS_GEN_BUILD_CORVUS_SLOT_BATCH_TEST_AGG_H
+
+#include "Ccorvus_slot_batch_testTopModuleGen.h"
+#include "Ccorvus_slot_batch_testSimWorkerGenP0.h"
+#include "Ccorvus_slot_batch_testSimWorkerGenP1.h"
+#include "Ccorvus_slot_batch_testSimWorkerGenP2.h"
+
+#endif // CORVUS_GEN_BUILD_CORVUS_SLOT_BATCH_TEST_AGG_H
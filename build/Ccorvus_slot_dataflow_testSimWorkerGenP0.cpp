@@ -0,0 +1,106 @@
+#include "Ccorvus_slot_dataflow_testSimWorkerGenP0.h"
+#include "Vcorvus_comb_P0.h"
+#include "Vcorvus_seq_P0.h"
+
+namespace corvus_generated {
+
+Ccorvus_slot_dataflow_testSimWorkerGenP0::Ccorvus_slot_dataflow_testSimWorkerGenP0(
+    CorvusSimWorkerSynctreeEndpoint* simWorkerSynctreeEndpoint,
+    std::vector<CorvusBusEndpoint*> mBusEndpoints,
+    std::vector<CorvusBusEndpoint*> sBusEndpoints)
+    : CorvusSimWorker(simWorkerSynctreeEndpoint, std::move(mBusEndpoints), std::move(sBusEndpoints)) {
+  setName("Ccorvus_slot_dataflow_testSimWorkerGenP0");
+  assert(this->mBusEndpoints.size() >= kCorvusGenMBusCount && "MBus endpoint count insufficient");
+  assert(this->sBusEndpoints.size() >= kCorvusGenSBusCount + kCorvusGenXBusCount && "SBus endpoint count insufficient");
+  setDataflowPeers(1, corvusGenDataflowPeers(1));
+  setDataflowLead(corvusGenDataflowLead(1));
+  setSyncMode(kCorvusGenSyncMode);
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP0::createSimModules() {
+  cModule = new VerilatorModuleHandle<Vcorvus_comb_P0>(corvusNewModule<Vcorvus_comb_P0>(verilatedContext));
+  sModule = new VerilatorModuleHandle<Vcorvus_seq_P0>(corvusNewModule<Vcorvus_seq_P0>(verilatedContext));
+}
+void Ccorvus_slot_dataflow_testSimWorkerGenP0::deleteSimModules() {
+  auto* cHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P0>* >(cModule);
+  if (cHandle) { delete cHandle->mp; delete cHandle; }
+  auto* sHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P0>* >(sModule);
+  if (sHandle) { delete sHandle->mp; delete sHandle; }
+  cModule = nullptr; sModule = nullptr;
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP0::loadMBusCInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P0>* >(cModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  if (!comb) return;
+  const uint64_t kSlotMask = 0xFFFFFFFFULL;
+  for (size_t ep = 0; ep < mBusEndpoints.size(); ++ep) {
+    int cnt = mBusEndpoints[ep]->bufferCnt();
+    for (int i = 0; i < cnt; ++i) {
+      uint64_t payload = mBusEndpoints[ep]->recv();
+      uint32_t slotId = static_cast<uint32_t>(payload & kSlotMask);
+      switch (slotId) {
+      case 0: {
+        uint64_t data = (payload >> 32) & 0xFFFFULL;
+        int bitOffset = 0;
+        comb->in_top = static_cast<CData>(data);
+        break;
+      }
+      default: break;
+      }
+    }
+  }
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP0::loadSBusCInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P0>* >(cModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  if (!comb) return;
+  const uint64_t kSlotMask = 0xFFFFFFFFULL;
+  (void)kSlotMask;
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP0::sendMBusCOutputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P0>* >(cModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  if (!comb) return;
+  (void)comb;
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP0::copySInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P0>* >(cModule);
+  auto* seqHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P0>* >(sModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  auto* seq = seqHandle ? seqHandle->mp : nullptr;
+  if (!comb || !seq) return;
+  seq->c0_to_s0 = comb->c0_to_s0;
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP0::sendSBusSOutputs() {
+  auto* seqHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P0>* >(sModule);
+  auto* seq = seqHandle ? seqHandle->mp : nullptr;
+  if (!seq) return;
+  size_t sbus_rr = 0;
+  uint64_t payload = 0;
+  uint64_t slice_data = 0;
+  {
+    const uint32_t targetId = 2;
+    CorvusBusEndpoint* ep = sBusEndpoints[sbus_rr % sBusEndpoints.size()];
+    ++sbus_rr;
+    uint64_t src_val = static_cast<uint64_t>(seq->s0_to_c1);
+    slice_data = (src_val >> 0) & 0xFFFFULL;
+    payload = static_cast<uint64_t>(0);
+    payload |= (slice_data << 32);
+    ep->send(targetId, payload);
+  }
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP0::copyLocalCInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P0>* >(cModule);
+  auto* seqHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P0>* >(sModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  auto* seq = seqHandle ? seqHandle->mp : nullptr;
+  if (!comb || !seq) return;
+}
+
+} // namespace corvus_generated
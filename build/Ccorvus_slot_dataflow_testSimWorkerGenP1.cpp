@@ -0,0 +1,106 @@
+#include "Ccorvus_slot_dataflow_testSimWorkerGenP1.h"
+#include "Vcorvus_comb_P1.h"
+#include "Vcorvus_seq_P1.h"
+
+namespace corvus_generated {
+
+Ccorvus_slot_dataflow_testSimWorkerGenP1::Ccorvus_slot_dataflow_testSimWorkerGenP1(
+    CorvusSimWorkerSynctreeEndpoint* simWorkerSynctreeEndpoint,
+    std::vector<CorvusBusEndpoint*> mBusEndpoints,
+    std::vector<CorvusBusEndpoint*> sBusEndpoints)
+    : CorvusSimWorker(simWorkerSynctreeEndpoint, std::move(mBusEndpoints), std::move(sBusEndpoints)) {
+  setName("Ccorvus_slot_dataflow_testSimWorkerGenP1");
+  assert(this->mBusEndpoints.size() >= kCorvusGenMBusCount && "MBus endpoint count insufficient");
+  assert(this->sBusEndpoints.size() >= kCorvusGenSBusCount + kCorvusGenXBusCount && "SBus endpoint count insufficient");
+  setDataflowPeers(2, corvusGenDataflowPeers(2));
+  setDataflowLead(corvusGenDataflowLead(2));
+  setSyncMode(kCorvusGenSyncMode);
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP1::createSimModules() {
+  cModule = new VerilatorModuleHandle<Vcorvus_comb_P1>(corvusNewModule<Vcorvus_comb_P1>(verilatedContext));
+  sModule = new VerilatorModuleHandle<Vcorvus_seq_P1>(corvusNewModule<Vcorvus_seq_P1>(verilatedContext));
+}
+void Ccorvus_slot_dataflow_testSimWorkerGenP1::deleteSimModules() {
+  auto* cHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P1>* >(cModule);
+  if (cHandle) { delete cHandle->mp; delete cHandle; }
+  auto* sHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P1>* >(sModule);
+  if (sHandle) { delete sHandle->mp; delete sHandle; }
+  cModule = nullptr; sModule = nullptr;
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP1::loadMBusCInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P1>* >(cModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  if (!comb) return;
+  const uint64_t kSlotMask = 0xFFFFFFFFULL;
+  (void)kSlotMask;
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP1::loadSBusCInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P1>* >(cModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  if (!comb) return;
+  const uint64_t kSlotMask = 0xFFFFFFFFULL;
+  for (size_t ep = 0; ep < sBusEndpoints.size(); ++ep) {
+    int cnt = sBusEndpoints[ep]->bufferCnt();
+    for (int i = 0; i < cnt; ++i) {
+      uint64_t payload = sBusEndpoints[ep]->recv();
+      uint32_t slotId = static_cast<uint32_t>(payload & kSlotMask);
+      switch (slotId) {
+      case 0: {
+        uint64_t data = (payload >> 32) & 0xFFFFULL;
+        int bitOffset = 0;
+        comb->s0_to_c1 = static_cast<SData>(data);
+        break;
+      }
+      default: break;
+      }
+    }
+  }
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP1::sendMBusCOutputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P1>* >(cModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  if (!comb) return;
+  size_t mbus_rr = 0;
+  uint64_t payload = 0;
+  uint64_t slice_data = 0;
+  {
+    // slot 0
+    CorvusBusEndpoint* ep = mBusEndpoints[mbus_rr % mBusEndpoints.size()];
+    ++mbus_rr;
+    uint64_t src_val = static_cast<uint64_t>(comb->out_top);
+    slice_data = (src_val >> 0) & 0xFFFFULL;
+    payload = static_cast<uint64_t>(0);
+    payload |= (slice_data << 32);
+    ep->send(0, payload);
+  }
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP1::copySInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P1>* >(cModule);
+  auto* seqHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P1>* >(sModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  auto* seq = seqHandle ? seqHandle->mp : nullptr;
+  if (!comb || !seq) return;
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP1::sendSBusSOutputs() {
+  auto* seqHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P1>* >(sModule);
+  auto* seq = seqHandle ? seqHandle->mp : nullptr;
+  if (!seq) return;
+  (void)seq;
+}
+
+void Ccorvus_slot_dataflow_testSimWorkerGenP1::copyLocalCInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P1>* >(cModule);
+  auto* seqHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P1>* >(sModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  auto* seq = seqHandle ? seqHandle->mp : nullptr;
+  if (!comb || !seq) return;
+  comb->s0_to_c1 = seq->stub_out;
+}
+
+} // namespace corvus_generated
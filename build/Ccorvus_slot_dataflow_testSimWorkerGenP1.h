@@ -0,0 +1,67 @@
+#ifndef CORVUS_GEN_BUILD_CORVUS_SLOT_DATAFLOW_TEST_WORKER_P1_H
+#define CORVUS_GEN_BUILD_CORVUS_SLOT_DATAFLOW_TEST_WORKER_P1_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "boilerplate/common/module_handle.h"
+#include "boilerplate/common/top_ports.h"
+#include "boilerplate/corvus/corvus_top_module.h"
+#include "boilerplate/corvus/corvus_sim_worker.h"
+#include "Vcorvus_comb_P1.h"
+#include "Vcorvus_seq_P1.h"
+
+namespace corvus_generated {
+
+#ifndef CORVUS_GEN_BUILD_CORVUS_SLOT_DATAFLOW_TEST_COUNTS_H
+#define CORVUS_GEN_BUILD_CORVUS_SLOT_DATAFLOW_TEST_COUNTS_H
+inline constexpr size_t kCorvusGenMBusCount = 1;
+inline constexpr size_t kCorvusGenSBusCount = 1;
+inline constexpr size_t kCorvusGenXBusCount = 0;
+inline constexpr size_t kCorvusGenPartitionGroupCount = 1;
+inline constexpr CorvusSyncMode kCorvusGenSyncMode = CorvusSyncMode::DATAFLOW;
+inline std::vector<uint32_t> corvusGenDataflowPeers(uint32_t endpointId) {
+  switch (endpointId) {
+  case 1: return {2};
+  case 2: return {1};
+  default: return {};
+  }
+}
+inline std::vector<uint32_t> corvusGenDataflowWorkers() { return {1, 2}; }
+inline std::vector<uint32_t> corvusGenDataflowTopWorkers() { return {1, 2}; }
+inline constexpr uint32_t kCorvusGenDataflowSlack = 2;
+inline uint32_t corvusGenDataflowLead(uint32_t endpointId) {
+  switch (endpointId) {
+  case 1:
+  case 2:
+    return 0;
+  default: return kCorvusGenDataflowSlack;
+  }
+}
+#endif
+
+class Ccorvus_slot_dataflow_testSimWorkerGenP1 : public CorvusSimWorker {
+public:
+  Ccorvus_slot_dataflow_testSimWorkerGenP1(CorvusSimWorkerSynctreeEndpoint* simWorkerSynctreeEndpoint,
+                       std::vector<CorvusBusEndpoint*> mBusEndpoints,
+                       std::vector<CorvusBusEndpoint*> sBusEndpoints);
+protected:
+  void createSimModules() override;
+  void deleteSimModules() override;
+  void loadMBusCInputs() override;
+  void loadSBusCInputs() override;
+  void sendMBusCOutputs() override;
+  void copySInputs() override;
+  void sendSBusSOutputs() override;
+  void copyLocalCInputs() override;
+};
+
+} // namespace corvus_generated
+#endif // CORVUS_GEN_BUILD_CORVUS_SLOT_DATAFLOW_TEST_WORKER_P1_H
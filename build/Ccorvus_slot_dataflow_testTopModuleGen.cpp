@@ -0,0 +1,92 @@
+#include "Ccorvus_slot_dataflow_testTopModuleGen.h"
+
+namespace corvus_generated {
+
+Ccorvus_slot_dataflow_testTopModuleGen::Ccorvus_slot_dataflow_testTopModuleGen(CorvusTopSynctreeEndpoint* topSynctreeEndpoint,
+                                     std::vector<CorvusBusEndpoint*> mBusEndpoints)
+    : CorvusTopModule(topSynctreeEndpoint, std::move(mBusEndpoints)) {
+  assert(this->mBusEndpoints.size() >= kCorvusGenMBusCount && "MBus endpoint count insufficient");
+  setDataflowWorkers(corvusGenDataflowWorkers(), corvusGenDataflowTopWorkers());
+  setDataflowSlack(kCorvusGenDataflowSlack);
+  setSyncMode(kCorvusGenSyncMode);
+}
+
+TopPorts* Ccorvus_slot_dataflow_testTopModuleGen::createTopPorts() { return new TopPortsGen(); }
+void Ccorvus_slot_dataflow_testTopModuleGen::deleteTopPorts() {
+  delete static_cast<Ccorvus_slot_dataflow_testTopModuleGen::TopPortsGen*>(topPorts);
+  topPorts = nullptr;
+}
+ModuleHandle* Ccorvus_slot_dataflow_testTopModuleGen::createExternalModule() { return nullptr; }
+void Ccorvus_slot_dataflow_testTopModuleGen::deleteExternalModule() { eModule = nullptr; }
+void Ccorvus_slot_dataflow_testTopModuleGen::sendIAndEOutput() {
+  auto* ports = static_cast<Ccorvus_slot_dataflow_testTopModuleGen::TopPortsGen*>(topPorts);
+  (void)ports;
+  (void)eModule;
+  size_t mbus_rr = 0;
+  uint64_t payload = 0;
+  uint64_t slice_data = 0;
+  {
+    const uint32_t targetId = 1;
+    CorvusBusEndpoint* ep = mBusEndpoints[mbus_rr % mBusEndpoints.size()];
+    ++mbus_rr;
+    uint64_t src_val = static_cast<uint64_t>(ports->in_top);
+    slice_data = (src_val >> 0) & 0xFFFFULL;
+    payload = static_cast<uint64_t>(0);
+    payload |= (slice_data << 32);
+    ep->send(targetId, payload);
+  }
+}
+
+void Ccorvus_slot_dataflow_testTopModuleGen::loadOAndEInput() {
+  auto* ports = static_cast<Ccorvus_slot_dataflow_testTopModuleGen::TopPortsGen*>(topPorts);
+  (void)ports;
+  (void)eModule;
+  const uint64_t kSlotMask = 0xFFFFFFFFULL;
+  for (size_t ep = 0; ep < mBusEndpoints.size(); ++ep) {
+    int cnt = mBusEndpoints[ep]->bufferCnt();
+    for (int i = 0; i < cnt; ++i) {
+      uint64_t payload = mBusEndpoints[ep]->recv();
+      uint32_t slotId = static_cast<uint32_t>(payload & kSlotMask);
+      switch (slotId) {
+      case 0: {
+        uint64_t data = (payload >> 32) & 0xFFFFULL;
+        int bitOffset = 0;
+        if (ports) {
+          ports->out_top = static_cast<CData>(data);
+        }
+        break;
+      }
+      default: break;
+      }
+    }
+  }
+}
+
+namespace {
+const TopPortDesc kTopPortDescs[] = {
+  {"in_top", static_cast<uint32_t>(offsetof(Ccorvus_slot_dataflow_testTopModuleGen::TopPortsGen, in_top)), 8, TopPortDesc::VL_8, TopPortDesc::INPUT, 0, 1},
+  {"out_top", static_cast<uint32_t>(offsetof(Ccorvus_slot_dataflow_testTopModuleGen::TopPortsGen, out_top)), 8, TopPortDesc::VL_8, TopPortDesc::OUTPUT, 0, 1},
+};
+const uint32_t kTopPortDisplacements[] = {
+  1,
+};
+const int32_t kTopPortSlots[] = {
+  -1, 1, 0, -1,
+};
+} // namespace
+
+const TopPortDesc* Ccorvus_slot_dataflow_testTopModuleGen::TopPortsGen::portDescs() { return kTopPortDescs; }
+
+const TopPortDesc* Ccorvus_slot_dataflow_testTopModuleGen::TopPortsGen::findPort(std::string_view name) {
+  return topPortFind(name, kTopPortDescs, kTopPortDisplacements, 1, kTopPortSlots, 3);
+}
+
+void Ccorvus_slot_dataflow_testTopModuleGen::TopPortsGen::setInputs(const uint32_t* words) {
+  in_top = static_cast<CData>(words[0]);
+}
+
+void Ccorvus_slot_dataflow_testTopModuleGen::TopPortsGen::getOutputs(uint32_t* words) const {
+  words[0] = out_top;
+}
+
+} // namespace corvus_generated
@@ -0,0 +1,76 @@
+#ifndef CORVUS_GEN_BUILD_CORVUS_SLOT_FAR_GROUP_TEST_PLAN_WORKER_H
+#define CORVUS_GEN_BUILD_CORVUS_SLOT_FAR_GROUP_TEST_PLAN_WORKER_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "boilerplate/common/module_handle.h"
+#include "boilerplate/corvus/corvus_plan_sim_worker.h"
+#include "Vcorvus_comb_P0.h"
+#include "Vcorvus_comb_P1.h"
+#include "Vcorvus_seq_P0.h"
+#include "Vcorvus_seq_P1.h"
+
+namespace corvus_generated {
+
+class Ccorvus_slot_far_group_testPlanWorkerGenP0 : public CorvusPlanSimWorker {
+public:
+  Ccorvus_slot_far_group_testPlanWorkerGenP0(CorvusSimWorkerSynctreeEndpoint* simWorkerSynctreeEndpoint,
+      std::vector<CorvusBusEndpoint*> mBusEndpoints,
+      std::vector<CorvusBusEndpoint*> sBusEndpoints,
+      std::string planPath)
+      : CorvusPlanSimWorker(simWorkerSynctreeEndpoint, std::move(mBusEndpoints),
+                            std::move(sBusEndpoints), 0, std::move(planPath)) {}
+protected:
+  void createPlanModules(CorvusPlanPortMap& combPorts, CorvusPlanPortMap& seqPorts) override {
+    auto* comb = corvusNewModule<Vcorvus_comb_P0>(verilatedContext);
+    auto* seq = corvusNewModule<Vcorvus_seq_P0>(verilatedContext);
+    cModule = new VerilatorModuleHandle<Vcorvus_comb_P0>(comb);
+    sModule = new VerilatorModuleHandle<Vcorvus_seq_P0>(seq);
+    combPorts.add("in_top", comb->in_top);
+    combPorts.add("c0_to_s0", comb->c0_to_s0);
+    combPorts.add("in_ctl", comb->in_ctl);
+    seqPorts.add("c0_to_s0", seq->c0_to_s0);
+    seqPorts.add("s0_to_c1", seq->s0_to_c1);
+  }
+  void deletePlanModules() override {
+    auto* cHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P0>* >(cModule);
+    if (cHandle) { delete cHandle->mp; delete cHandle; }
+    auto* sHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P0>* >(sModule);
+    if (sHandle) { delete sHandle->mp; delete sHandle; }
+    cModule = nullptr; sModule = nullptr;
+  }
+};
+
+class Ccorvus_slot_far_group_testPlanWorkerGenP70 : public CorvusPlanSimWorker {
+public:
+  Ccorvus_slot_far_group_testPlanWorkerGenP70(CorvusSimWorkerSynctreeEndpoint* simWorkerSynctreeEndpoint,
+      std::vector<CorvusBusEndpoint*> mBusEndpoints,
+      std::vector<CorvusBusEndpoint*> sBusEndpoints,
+      std::string planPath)
+      : CorvusPlanSimWorker(simWorkerSynctreeEndpoint, std::move(mBusEndpoints),
+                            std::move(sBusEndpoints), 70, std::move(planPath)) {}
+protected:
+  void createPlanModules(CorvusPlanPortMap& combPorts, CorvusPlanPortMap& seqPorts) override {
+    auto* comb = corvusNewModule<Vcorvus_comb_P70>(verilatedContext);
+    auto* seq = corvusNewModule<Vcorvus_seq_P70>(verilatedContext);
+    cModule = new VerilatorModuleHandle<Vcorvus_comb_P70>(comb);
+    sModule = new VerilatorModuleHandle<Vcorvus_seq_P70>(seq);
+    combPorts.add("s0_to_c1", comb->s0_to_c1);
+    combPorts.add("out_top", comb->out_top);
+    combPorts.add("in_top", comb->in_top);
+    seqPorts.add("stub_in", seq->stub_in);
+    seqPorts.add("stub_out", seq->stub_out);
+  }
+  void deletePlanModules() override {
+    auto* cHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P70>* >(cModule);
+    if (cHandle) { delete cHandle->mp; delete cHandle; }
+    auto* sHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P70>* >(sModule);
+    if (sHandle) { delete sHandle->mp; delete sHandle; }
+    cModule = nullptr; sModule = nullptr;
+  }
+};
+
+} // namespace corvus_generated
+#endif // CORVUS_GEN_BUILD_CORVUS_SLOT_FAR_GROUP_TEST_PLAN_WORKER_H
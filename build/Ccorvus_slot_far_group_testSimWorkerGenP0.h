@@ -0,0 +1,49 @@
+#ifndef CORVUS_GEN_BUILD_CORVUS_SLOT_FAR_GROUP_TEST_WORKER_P0_H
+#define CORVUS_GEN_BUILD_CORVUS_SLOT_FAR_GROUP_TEST_WORKER_P0_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "boilerplate/common/module_handle.h"
+#include "boilerplate/common/top_ports.h"
+#include "boilerplate/corvus/corvus_top_module.h"
+#include "boilerplate/corvus/corvus_sim_worker.h"
+#include "Vcorvus_comb_P0.h"
+#include "Vcorvus_seq_P0.h"
+
+namespace corvus_generated {
+
+#ifndef CORVUS_GEN_BUILD_CORVUS_SLOT_FAR_GROUP_TEST_COUNTS_H
+#define CORVUS_GEN_BUILD_CORVUS_SLOT_FAR_GROUP_TEST_COUNTS_H
+inline constexpr size_t kCorvusGenMBusCount = 1;
+inline constexpr size_t kCorvusGenSBusCount = 1;
+inline constexpr size_t kCorvusGenXBusCount = 2;
+inline constexpr size_t kCorvusGenPartitionGroupCount = 2;
+inline constexpr CorvusSyncMode kCorvusGenSyncMode = CorvusSyncMode::BARRIER;
+#endif
+
+class Ccorvus_slot_far_group_testSimWorkerGenP0 : public CorvusSimWorker {
+public:
+  Ccorvus_slot_far_group_testSimWorkerGenP0(CorvusSimWorkerSynctreeEndpoint* simWorkerSynctreeEndpoint,
+                       std::vector<CorvusBusEndpoint*> mBusEndpoints,
+                       std::vector<CorvusBusEndpoint*> sBusEndpoints);
+protected:
+  void createSimModules() override;
+  void deleteSimModules() override;
+  void loadMBusCInputs() override;
+  void loadSBusCInputs() override;
+  void sendMBusCOutputs() override;
+  void copySInputs() override;
+  void sendSBusSOutputs() override;
+  void copyLocalCInputs() override;
+};
+
+} // namespace corvus_generated
+#endif // CORVUS_GEN_BUILD_CORVUS_SLOT_FAR_GROUP_TEST_WORKER_P0_H
@@ -0,0 +1,92 @@
+#include "Ccorvus_slot_far_group_testSimWorkerGenP70.h"
+#include "Vcorvus_comb_P1.h"
+#include "Vcorvus_seq_P1.h"
+
+namespace corvus_generated {
+
+Ccorvus_slot_far_group_testSimWorkerGenP70::Ccorvus_slot_far_group_testSimWorkerGenP70(
+    CorvusSimWorkerSynctreeEndpoint* simWorkerSynctreeEndpoint,
+    std::vector<CorvusBusEndpoint*> mBusEndpoints,
+    std::vector<CorvusBusEndpoint*> sBusEndpoints)
+    : CorvusSimWorker(simWorkerSynctreeEndpoint, std::move(mBusEndpoints), std::move(sBusEndpoints)) {
+  setName("Ccorvus_slot_far_group_testSimWorkerGenP70");
+  assert(this->mBusEndpoints.size() >= kCorvusGenMBusCount && "MBus endpoint count insufficient");
+  assert(this->sBusEndpoints.size() >= kCorvusGenSBusCount + kCorvusGenXBusCount && "SBus endpoint count insufficient");
+  setSyncMode(kCorvusGenSyncMode);
+}
+
+void Ccorvus_slot_far_group_testSimWorkerGenP70::createSimModules() {
+  cModule = new VerilatorModuleHandle<Vcorvus_comb_P70>(corvusNewModule<Vcorvus_comb_P70>(verilatedContext));
+  sModule = new VerilatorModuleHandle<Vcorvus_seq_P70>(corvusNewModule<Vcorvus_seq_P70>(verilatedContext));
+}
+void Ccorvus_slot_far_group_testSimWorkerGenP70::deleteSimModules() {
+  auto* cHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P70>* >(cModule);
+  if (cHandle) { delete cHandle->mp; delete cHandle; }
+  auto* sHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P70>* >(sModule);
+  if (sHandle) { delete sHandle->mp; delete sHandle; }
+  cModule = nullptr; sModule = nullptr;
+}
+
+void Ccorvus_slot_far_group_testSimWorkerGenP70::loadMBusCInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P70>* >(cModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  if (!comb) return;
+  const uint64_t kSlotMask = 0xFFFFFFFFULL;
+  (void)kSlotMask;
+}
+
+void Ccorvus_slot_far_group_testSimWorkerGenP70::loadSBusCInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P70>* >(cModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  if (!comb) return;
+  const uint64_t kSlotMask = 0xFFFFFFFFULL;
+  for (size_t ep = 0; ep < sBusEndpoints.size(); ++ep) {
+    int cnt = sBusEndpoints[ep]->bufferCnt();
+    for (int i = 0; i < cnt; ++i) {
+      uint64_t payload = sBusEndpoints[ep]->recv();
+      uint32_t slotId = static_cast<uint32_t>(payload & kSlotMask);
+      switch (slotId) {
+      case 0: {
+        uint64_t data = (payload >> 32) & 0xFFFFULL;
+        int bitOffset = 0;
+        comb->s0_to_c1 = static_cast<SData>(data);
+        break;
+      }
+      default: break;
+      }
+    }
+  }
+}
+
+void Ccorvus_slot_far_group_testSimWorkerGenP70::sendMBusCOutputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P70>* >(cModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  if (!comb) return;
+  (void)comb;
+}
+
+void Ccorvus_slot_far_group_testSimWorkerGenP70::copySInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P70>* >(cModule);
+  auto* seqHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P70>* >(sModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  auto* seq = seqHandle ? seqHandle->mp : nullptr;
+  if (!comb || !seq) return;
+}
+
+void Ccorvus_slot_far_group_testSimWorkerGenP70::sendSBusSOutputs() {
+  auto* seqHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P70>* >(sModule);
+  auto* seq = seqHandle ? seqHandle->mp : nullptr;
+  if (!seq) return;
+  (void)seq;
+}
+
+void Ccorvus_slot_far_group_testSimWorkerGenP70::copyLocalCInputs() {
+  auto* combHandle = static_cast<VerilatorModuleHandle<Vcorvus_comb_P70>* >(cModule);
+  auto* seqHandle = static_cast<VerilatorModuleHandle<Vcorvus_seq_P70>* >(sModule);
+  auto* comb = combHandle ? combHandle->mp : nullptr;
+  auto* seq = seqHandle ? seqHandle->mp : nullptr;
+  if (!comb || !seq) return;
+  comb->s0_to_c1 = seq->stub_out;
+}
+
+} // namespace corvus_generated
@@ -0,0 +1,8 @@
+#ifndef CORVUS_GEN_BUILD_CORVUS_SLOT_GROUP_TEST_AGG_H
+#define CORVUS_GEN_BUILD_CORVUS_SLOT_GROUP_TEST_AGG_H
+
+#include "Ccorvus_slot_group_testTopModuleGen.h"
+#include "Ccorvus_slot_group_testSimWorkerGenP0.h"
+#include "Ccorvus_slot_group_testSimWorkerGenP1.h"
+
+#endif // CORVUS_GEN_BUILD_CORVUS_SLOT_GROUP_TEST_AGG_H
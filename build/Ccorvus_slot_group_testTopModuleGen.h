@@ -0,0 +1,61 @@
+#ifndef CORVUS_GEN_BUILD_CORVUS_SLOT_GROUP_TEST_TOP_H
+#define CORVUS_GEN_BUILD_CORVUS_SLOT_GROUP_TEST_TOP_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "boilerplate/common/module_handle.h"
+#include "boilerplate/common/top_ports.h"
+#include "boilerplate/corvus/corvus_top_module.h"
+#include "boilerplate/corvus/corvus_sim_worker.h"
+
+namespace corvus_generated {
+
+#ifndef CORVUS_GEN_BUILD_CORVUS_SLOT_GROUP_TEST_COUNTS_H
+#define CORVUS_GEN_BUILD_CORVUS_SLOT_GROUP_TEST_COUNTS_H
+inline constexpr size_t kCorvusGenMBusCount = 1;
+inline constexpr size_t kCorvusGenSBusCount = 1;
+inline constexpr size_t kCorvusGenXBusCount = 2;
+inline constexpr size_t kCorvusGenPartitionGroupCount = 2;
+inline constexpr CorvusSyncMode kCorvusGenSyncMode = CorvusSyncMode::BARRIER;
+#endif
+
+class Ccorvus_slot_group_testTopModuleGen : public CorvusTopModule {
+public:
+  class TopPortsGen : public TopPorts {
+  public:
+    CData in_top;
+    CData out_top;
+
+    static constexpr size_t kPortCount = 2;
+    static constexpr uint32_t kInputWords = 1;
+    static constexpr uint32_t kOutputWords = 1;
+    // kPortCount descriptors (inputs first); findPort is a perfect-hash
+    // lookup returning nullptr for unknown names.
+    static const TopPortDesc* portDescs();
+    static const TopPortDesc* findPort(std::string_view name);
+    // Bulk copy through packed word vectors laid out by TopPortDesc::wordOffset.
+    void setInputs(const uint32_t* words);
+    void getOutputs(uint32_t* words) const;
+  };
+
+  Ccorvus_slot_group_testTopModuleGen(CorvusTopSynctreeEndpoint* topSynctreeEndpoint,
+                     std::vector<CorvusBusEndpoint*> mBusEndpoints);
+protected:
+  TopPorts* createTopPorts() override;
+  void deleteTopPorts() override;
+  ModuleHandle* createExternalModule() override;
+  void deleteExternalModule() override;
+  void sendIAndEOutput() override;
+  void loadOAndEInput() override;
+};
+
+} // namespace corvus_generated
+#endif // CORVUS_GEN_BUILD_CORVUS_SLOT_GROUP_TEST_TOP_H
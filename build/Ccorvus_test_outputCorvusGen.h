@@ -0,0 +1,7 @@
+#ifndef CORVUS_GEN_BUILD_CORVUS_TEST_OUTPUT_AGG_H
+#define CORVUS_GEN_BUILD_CORVUS_TEST_OUTPUT_AGG_H
+
+#include "Ccorvus_test_outputTopModuleGen.h"
+#include "Ccorvus_test_outputSimWorkerGenP0.h"
+
+#endif // CORVUS_GEN_BUILD_CORVUS_TEST_OUTPUT_AGG_H
@@ -0,0 +1,123 @@
+#include "Ccorvus_test_outputTopModuleGen.h"
+#include "Vcorvus_external.h"
+
+namespace corvus_generated {
+
+Ccorvus_test_outputTopModuleGen::Ccorvus_test_outputTopModuleGen(CorvusTopSynctreeEndpoint* topSynctreeEndpoint,
+                                     std::vector<CorvusBusEndpoint*> mBusEndpoints)
+    : CorvusTopModule(topSynctreeEndpoint, std::move(mBusEndpoints)) {
+  assert(this->mBusEndpoints.size() >= kCorvusGenMBusCount && "MBus endpoint count insufficient");
+  setSyncMode(kCorvusGenSyncMode);
+}
+
+TopPorts* Ccorvus_test_outputTopModuleGen::createTopPorts() { return new TopPortsGen(); }
+void Ccorvus_test_outputTopModuleGen::deleteTopPorts() {
+  delete static_cast<Ccorvus_test_outputTopModuleGen::TopPortsGen*>(topPorts);
+  topPorts = nullptr;
+}
+ModuleHandle* Ccorvus_test_outputTopModuleGen::createExternalModule() {
+  auto* inst = corvusNewModule<Vcorvus_external>(verilatedContext);
+  return new VerilatorModuleHandle<Vcorvus_external>(inst);
+}
+void Ccorvus_test_outputTopModuleGen::deleteExternalModule() {
+  auto* handle = static_cast<VerilatorModuleHandle<Vcorvus_external>*>(eModule);
+  if (handle) {
+    delete handle->mp;
+    delete handle;
+    eModule = nullptr;
+  }
+}
+void Ccorvus_test_outputTopModuleGen::sendIAndEOutput() {
+  auto* ports = static_cast<Ccorvus_test_outputTopModuleGen::TopPortsGen*>(topPorts);
+  (void)ports;
+  auto* eHandle = static_cast<VerilatorModuleHandle<Vcorvus_external>*>(eModule);
+  auto* ext = eHandle ? eHandle->mp : nullptr;
+  (void)ext;
+  size_t mbus_rr = 0;
+  uint64_t payload = 0;
+  uint64_t slice_data = 0;
+  {
+    const uint32_t targetId = 1;
+    CorvusBusEndpoint* ep = mBusEndpoints[mbus_rr % mBusEndpoints.size()];
+    ++mbus_rr;
+    uint64_t src_val = static_cast<uint64_t>(ports->in0);
+    slice_data = (src_val >> 0) & 0xFFFFULL;
+    payload = static_cast<uint64_t>(0);
+    payload |= (slice_data << 32);
+    ep->send(targetId, payload);
+  }
+  {
+    const uint32_t targetId = 1;
+    CorvusBusEndpoint* ep = mBusEndpoints[mbus_rr % mBusEndpoints.size()];
+    ++mbus_rr;
+    uint64_t src_val = static_cast<uint64_t>(ext->eo0);
+    slice_data = (src_val >> 0) & 0xFFFFULL;
+    payload = static_cast<uint64_t>(1);
+    payload |= (slice_data << 32);
+    ep->send(targetId, payload);
+  }
+}
+
+void Ccorvus_test_outputTopModuleGen::loadOAndEInput() {
+  auto* ports = static_cast<Ccorvus_test_outputTopModuleGen::TopPortsGen*>(topPorts);
+  (void)ports;
+  auto* eHandle = static_cast<VerilatorModuleHandle<Vcorvus_external>*>(eModule);
+  auto* ext = eHandle ? eHandle->mp : nullptr;
+  (void)ext;
+  const uint64_t kSlotMask = 0xFFFFFFFFULL;
+  for (size_t ep = 0; ep < mBusEndpoints.size(); ++ep) {
+    int cnt = mBusEndpoints[ep]->bufferCnt();
+    for (int i = 0; i < cnt; ++i) {
+      uint64_t payload = mBusEndpoints[ep]->recv();
+      uint32_t slotId = static_cast<uint32_t>(payload & kSlotMask);
+      switch (slotId) {
+      case 0: {
+        uint64_t data = (payload >> 32) & 0xFFFFULL;
+        int bitOffset = 0;
+        if (ports) {
+          ports->out0 = static_cast<CData>(data);
+        }
+        break;
+      }
+      case 1: {
+        uint64_t data = (payload >> 32) & 0xFFFFULL;
+        int bitOffset = 0;
+        if (ext) {
+          ext->ei0 = static_cast<CData>(data);
+        }
+        break;
+      }
+      default: break;
+      }
+    }
+  }
+}
+
+namespace {
+const TopPortDesc kTopPortDescs[] = {
+  {"in0", static_cast<uint32_t>(offsetof(Ccorvus_test_outputTopModuleGen::TopPortsGen, in0)), 1, TopPortDesc::VL_8, TopPortDesc::INPUT, 0, 1},
+  {"out0", static_cast<uint32_t>(offsetof(Ccorvus_test_outputTopModuleGen::TopPortsGen, out0)), 1, TopPortDesc::VL_8, TopPortDesc::OUTPUT, 0, 1},
+};
+const uint32_t kTopPortDisplacements[] = {
+  1,
+};
+const int32_t kTopPortSlots[] = {
+  1, -1, 0, -1,
+};
+} // namespace
+
+const TopPortDesc* Ccorvus_test_outputTopModuleGen::TopPortsGen::portDescs() { return kTopPortDescs; }
+
+const TopPortDesc* Ccorvus_test_outputTopModuleGen::TopPortsGen::findPort(std::string_view name) {
+  return topPortFind(name, kTopPortDescs, kTopPortDisplacements, 1, kTopPortSlots, 3);
+}
+
+void Ccorvus_test_outputTopModuleGen::TopPortsGen::setInputs(const uint32_t* words) {
+  in0 = static_cast<CData>(words[0]);
+}
+
+void Ccorvus_test_outputTopModuleGen::TopPortsGen::getOutputs(uint32_t* words) const {
+  words[0] = out0;
+}
+
+} // namespace corvus_generated
@@ -0,0 +1,8 @@
+#ifndef CORVUS_GEN_BUILD_BENCH_CORVUS_GENERATOR_OUT_BENCH_AGG_H
+#define CORVUS_GEN_BUILD_BENCH_CORVUS_GENERATOR_OUT_BENCH_AGG_H
+
+#include "CbenchTopModuleGen.h"
+#include "CbenchSimWorkerGenP3.h"
+#include "CbenchSimWorkerGenP7.h"
+
+#endif // CORVUS_GEN_BUILD_BENCH_CORVUS_GENERATOR_OUT_BENCH_AGG_H